@@ -56,7 +56,7 @@
 typedef struct
 {
     uint8_t width, height;
-    uint8_t const *bitmap;
+    uint8_t const *rows; // height+1 offsets to the spans of each row
 } glyph_t;
 
 enum
@@ -84,15 +84,33 @@ typedef union
 typedef struct
 {
     int16_t x, y, width, height;
-    uint8_t yuv444[3];
+    uint32_t yuv422; // a pair of pixels, see yuv422_word()
     uint8_t type;
+    bool retained; // kept across show()
+    uint32_t id;   // increasing in list order, see find_obj()
     arg_t arg;
 } obj_t;
 
-obj_t obj_list[50];
-size_t obj_num;
+// The objects to draw, in order. The list lives on the GC heap so that
+// the strings of text objects stay alive as long as the objects do.
+MP_REGISTER_ROOT_POINTER(void *display_obj_list);
 
-static uint8_t const *font = font_50;
+static size_t obj_num, obj_alloc;
+static uint32_t obj_next_id;
+
+static obj_t *obj_list(void)
+{
+    // the heap and root pointers start over on a soft reset
+    if (MP_STATE_VM(display_obj_list) == NULL)
+    {
+        obj_num = 0;
+        obj_alloc = 0;
+    }
+    return MP_STATE_VM(display_obj_list);
+}
+
+static uint8_t const *font = font_50_spans;
+static uint16_t const *font_index = font_50_spans_index;
 static int16_t glyph_gap_width = 2;
 
 
@@ -137,32 +155,65 @@ STATIC mp_obj_t display_brightness(mp_obj_t brightness)
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(display_brightness_obj, &display_brightness);
 
-static inline void draw_pixel(row_t row, int16_t x, uint8_t yuv444[3])
+/**
+ * Pack a color as the two pixels of a YUV422 pair, U Y V Y in memory, so
+ * that spans are filled a word at a time.
+ */
+static inline uint32_t yuv422_word(uint8_t yuv444[3])
 {
-    // TODO this flips the screen horizontally on purpose
-    x = row.len / 2 - x;
+    uint8_t pair[4] = {yuv444[1], yuv444[0], yuv444[2], yuv444[0]};
+    uint32_t u32;
+
+    memcpy(&u32, pair, sizeof u32);
+    return u32;
+}
 
-    if (x * 2 + 0 < row.len)
+/**
+ * Fill the pixels [beg, end) of the row buffer, which the caller clipped.
+ * Even pixels carry U and odd pixels carry V, so the pairs in between are
+ * whole words and only the ends may need a half.
+ */
+static inline void fill_yuv422(row_t row, size_t beg, size_t end, uint32_t yuv422)
+{
+    uint8_t *p = row.buf + beg * 2;
+    uint8_t *e = row.buf + end * 2;
+    uint8_t pair[4];
+
+    memcpy(pair, &yuv422, sizeof pair);
+    if (beg % 2 == 1 && p < e)
+    {
+        memcpy(p, pair + 2, 2);
+        p += 2;
+    }
+    for (; p + 4 <= e; p += 4)
     {
-        row.buf[x * 2 + 0] = yuv444[1 + x % 2];
+        memcpy(p, &yuv422, 4);
     }
-    if (x * 2 + 1 < row.len)
+    if (p < e)
     {
-        row.buf[x * 2 + 1] = yuv444[0];
+        memcpy(p, pair, 2);
     }
 }
 
-static inline void draw_segment(row_t row, int16_t x_beg, int16_t x_end, uint8_t yuv444[3])
+static inline void draw_segment(row_t row, int16_t x_beg, int16_t x_end, uint32_t yuv422)
 {
-    for (size_t len = row.len / 2, x = x_beg; x < x_end && x < len; x++)
+    int16_t len = row.len / 2;
+
+    // Clip to the pixels x = 1 .. len-1, the rest is off the screen.
+    x_beg = MAX(x_beg, 1);
+    x_end = MIN(x_end, len);
+    if (x_beg >= x_end)
     {
-        draw_pixel(row, x, yuv444);
+        return;
     }
+
+    // TODO this flips the screen horizontally on purpose
+    fill_yuv422(row, len - x_end + 1, len - x_beg + 1, yuv422);
 }
 
 static void render_rectangle(row_t row, obj_t *obj)
 {
-    draw_segment(row, obj->x, obj->x + obj->width, obj->yuv444);
+    draw_segment(row, obj->x, obj->x + obj->width, obj->yuv422);
 }
 
 /**
@@ -207,43 +258,32 @@ static void render_line(row_t row, obj_t *obj)
     x1 = intersect_line(row.y, line_x1, line_y1, obj->width, obj->height, flip);
 
     // We then fill the pixels between these two points.
-    draw_segment(row, MIN(x0, x1), MAX(x0, x1), obj->yuv444);
+    draw_segment(row, MIN(x0, x1), MAX(x0, x1), obj->yuv422);
 }
 
-static inline glyph_t get_glyph(uint8_t const *font, char c)
+static inline glyph_t get_glyph(uint8_t const *font, uint16_t const *index, char c)
 {
     glyph_t glyph;
-    uint8_t const *f = font;
+    uint8_t const *f;
 
     // Only ASCII is supported for this early release
     // see how https://www.cl.cam.ac.uk/~mgk25/ucs/wcwidth.c
     // encoded lookup tables for a strategy to support UTF-8.
     if (c < ' ' || c > '~')
     {
-        return get_glyph(font, ' ');
+        c = ' ';
     }
 
     // Store the global font header properties.
-    glyph.height = *f++;
+    glyph.height = font[0];
 
-    // Scan the font, seeking for the glyph to render.
-    for (char i = ' '; i <= c; i++)
-    {
-        glyph.width = *f++;
-        glyph.bitmap = f;
-        f += (glyph.width * glyph.height + 7) / 8;
-    }
+    // The index generated by txt2cfont points at the glyph's width byte.
+    f = font + index[c - ' '];
+    glyph.width = f[0];
+    glyph.rows = f + 1;
     return glyph;
 }
 
-static inline bool get_glyph_bit(glyph_t *glyph, int16_t x, int16_t y)
-{
-    size_t i = y * glyph->width + x;
-
-    // See the txt2cfont tool to understand this encoding.
-    return glyph->bitmap[i / 8] & 1 << (i % 8);
-}
-
 /**
  * Render a single glyph onto the buffer.
  *
@@ -253,17 +293,19 @@ static inline bool get_glyph_bit(glyph_t *glyph, int16_t x, int16_t y)
  *
  * @param glpyh The glyph to render.
  */
-static inline void draw_glyph(row_t row, int16_t x0, glyph_t *glyph, uint16_t y0, uint8_t yuv444[3])
+static inline void draw_glyph(row_t row, int16_t x0, glyph_t *glyph, uint16_t y0, uint32_t yuv422)
 {
-    // for each vertical position
-    for (int16_t x = 0; x < glyph->width; x++)
+    // The (start, length) pairs of the row follow the offsets table,
+    // see the txt2cfont tool (-s) to understand this encoding.
+    uint8_t const *span = glyph->rows + glyph->height + 1;
+
+    // for each horizontal run of the glyph on this row
+    for (uint8_t i = glyph->rows[y0]; i < glyph->rows[y0 + 1]; i += 2)
     {
-        // check if the bit is set
-        if (get_glyph_bit(glyph, x, y0) == true)
-        {
-            // and only if so, fill the buffer with it
-            draw_pixel(row, x0 + x, yuv444);
-        }
+        int16_t x = x0 + span[i];
+
+        // fill the whole run at once
+        draw_segment(row, x, x + span[i + 1], yuv422);
     }
 }
 
@@ -279,7 +321,7 @@ int16_t get_text_width(char const *s, size_t len)
     {
         // Accumulate the width of this glyph to render
         width += (i == 0) ? 0 : glyph_gap_width;
-        width += get_glyph(font, s[i]).width;
+        width += get_glyph(font, font_index, s[i]).width;
     }
     return width;
 }
@@ -294,7 +336,7 @@ static void render_text(row_t row, obj_t *obj)
     char const *s = obj->arg.ptr;
 
     // Only a single row of text is supported.
-    if (row.y > obj->y + font[0])
+    if (row.y < obj->y || row.y >= obj->y + font[0])
     {
         return;
     }
@@ -304,11 +346,11 @@ static void render_text(row_t row, obj_t *obj)
         glyph_t glyph;
 
         // search the glyph within the font data
-        glyph = get_glyph(font, *s);
+        glyph = get_glyph(font, font_index, *s);
 
         // render the glyph, reduce the buffer to only the section to draw into,
         // y coordinate is adjusted to be height within the glyph
-        draw_glyph(row, x, &glyph, row.y - obj->y, obj->yuv444);
+        draw_glyph(row, x, &glyph, row.y - obj->y, obj->yuv422);
         x += glyph.width + glyph_gap_width;
     }
 }
@@ -344,28 +386,106 @@ static void render_ellipsis(row_t row, obj_t *obj)
 void fill_black(row_t row)
 {
     uint8_t black[] = YUV422_BLACK;
+    uint8_t yuv444[3] = {black[1], black[0], black[0]};
 
-    for (size_t i = 0; i + 1 < row.len; i += 2)
+    fill_yuv422(row, 0, row.len / 2, yuv422_word(yuv444));
+}
+
+/**
+ * Objects ordered by the first row they cover, so that each row only
+ * visits the objects overlapping it. Objects join the active list on
+ * their first row and leave it after their last, and the active list is
+ * kept in object order so that later objects still draw on top.
+ */
+typedef struct
+{
+    obj_t *list;
+    uint16_t *order;  // object indexes by increasing first row
+    uint16_t *active; // indexes of the objects on the row, increasing
+    size_t num, next, active_num;
+} obj_index_t;
+
+static void index_init(obj_index_t *idx, obj_t *list, size_t num,
+                       uint16_t *order, uint16_t *active)
+{
+    idx->list = list;
+    idx->order = order;
+    idx->active = active;
+    idx->num = num;
+    idx->next = 0;
+    idx->active_num = 0;
+
+    // Insertion sort, stable so objects on one row keep their order
+    for (size_t i = 0; i < num; i++)
     {
-        memcpy(row.buf + i, black, sizeof black);
+        size_t j = i;
+
+        for (; j > 0 && list[order[j - 1]].y > list[i].y; j--)
+        {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
     }
 }
 
-bool render_row(row_t row, obj_t *obj_list, size_t obj_num)
+/**
+ * Update the active list for row y, and return the first row from y on
+ * that has any object on it, or one at or past DISPLAY_HEIGHT once none
+ * is left on the screen.
+ */
+static int16_t index_advance(obj_index_t *idx, int16_t y)
 {
-    bool drawn = false;
+    size_t n = 0;
 
-    for (size_t i = 0; i < obj_num; i++)
+    // Drop the objects that ended on the row before
+    for (size_t i = 0; i < idx->active_num; i++)
+    {
+        obj_t *obj = idx->list + idx->active[i];
+
+        if (y <= obj->y + obj->height)
+        {
+            idx->active[n++] = idx->active[i];
+        }
+    }
+    idx->active_num = n;
+
+    // Add the objects starting on this row, or above the screen
+    while (idx->next < idx->num)
     {
-        obj_t *obj = obj_list + i;
+        uint16_t k = idx->order[idx->next];
+        obj_t *obj = idx->list + k;
+        size_t j = idx->active_num;
+
+        if (obj->y > y)
+        {
+            if (idx->active_num > 0)
+            {
+                break;
+            }
+            // Nothing on this row, go straight to the object's first row
+            y = obj->y;
+        }
+        idx->next++;
 
-        // skip the object if it is not on the row we render.
-        if (row.y < obj->y || row.y > obj->y + obj->height)
+        if (y > obj->y + obj->height)
         {
             continue;
         }
+        for (; j > 0 && idx->active[j - 1] > k; j--)
+        {
+            idx->active[j] = idx->active[j - 1];
+        }
+        idx->active[j] = k;
+        idx->active_num++;
+    }
+    return (idx->active_num > 0) ? y : DISPLAY_HEIGHT;
+}
 
-        drawn = true;
+void render_row(row_t row, obj_index_t *idx)
+{
+    for (size_t i = 0; i < idx->active_num; i++)
+    {
+        obj_t *obj = idx->list + idx->active[i];
 
         switch (obj->type)
         {
@@ -399,7 +519,6 @@ bool render_row(row_t row, obj_t *obj_list, size_t obj_num)
         }
         }
     }
-    return drawn;
 }
 
 STATIC void flush_blocks(row_t yuv422, size_t pos, size_t len)
@@ -499,10 +618,16 @@ STATIC void flush_row(row_t yuv422)
 
 STATIC mp_obj_t display_show(void)
 {
-    uint8_t buf[DISPLAY_WIDTH * 2];
+    uint32_t buf[DISPLAY_WIDTH / 2]; // pairs of pixels, word aligned
     uint8_t buf2[1 << 15];
     memset(buf2, 0, sizeof buf2);
-    row_t yuv422 = {.buf = buf, .len = sizeof buf, .y = 0};
+    row_t yuv422 = {.buf = (uint8_t *)buf, .len = sizeof buf, .y = 0};
+    obj_t *list = obj_list();
+    size_t order_len = 2 * obj_num + 1;
+    uint16_t *order = m_new(uint16_t, order_len);
+    obj_index_t idx;
+
+    index_init(&idx, list, obj_num, order, order + obj_num);
 
     // fill the display with YUV422 black pixels
     uint8_t enable_command[2] = {0x44, 0x05};
@@ -512,32 +637,78 @@ STATIC mp_obj_t display_show(void)
     spi_write(FPGA, clear_command, 2, false);
     nrfx_systick_delay_ms(30);
 
-    // Walk through every line of the display, render it, send it to the FPGA.
-    for (; yuv422.y < DISPLAY_HEIGHT; yuv422.y++)
+    // Walk through the lines of the display that have objects on them,
+    // render them and send them to the FPGA. The others stay cleared.
+    for (; (yuv422.y = index_advance(&idx, yuv422.y)) < DISPLAY_HEIGHT; yuv422.y++)
     {
         // Clean the row before writing to it
         fill_black(yuv422);
 
-        // Render a single row, and if anything was updated, also flush it
-        if (render_row(yuv422, obj_list, obj_num))
-        {
-            flush_row(yuv422);
-        }
+        render_row(yuv422, &idx);
+        flush_row(yuv422);
     }
 
     // The framebuffer we wrote to is ready, now we can display it.
     uint8_t buffer_swap_command[2] = {0x44, 0x07};
     spi_write(FPGA, buffer_swap_command, 2, false);
 
-    // Empty the list of elements to draw.
-    memset(obj_list, 0, sizeof obj_list);
-    obj_num = 0;
+    // Only the retained objects stay for the next frame, in order.
+    size_t n = 0;
+    for (size_t i = 0; i < obj_num; i++)
+    {
+        if (list[i].retained)
+        {
+            list[n++] = list[i];
+        }
+    }
+    memset(list + n, 0, (obj_num - n) * sizeof *list);
+    obj_num = n;
+    m_del(uint16_t, order, order_len);
 
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_0(display_show_obj, &display_show);
 
-STATIC void new_obj(int type, mp_int_t x, mp_int_t y, mp_int_t width, mp_int_t height, mp_int_t rgb, arg_t arg)
+/**
+ * A handle on an object of the display list, which stays valid until the
+ * object is shown without being retained, or deleted.
+ */
+typedef struct
+{
+    mp_obj_base_t base;
+    uint32_t id;
+} handle_obj_t;
+
+STATIC const mp_obj_type_t handle_type;
+
+// The list is in increasing id order, deletions keep it that way
+STATIC obj_t *find_obj(mp_obj_t self_in)
+{
+    handle_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    obj_t *list = obj_list();
+    size_t lo = 0, hi = obj_num;
+
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+
+        if (list[mid].id < self->id)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if (lo == obj_num || list[lo].id != self->id)
+    {
+        mp_raise_ValueError(MP_ERROR_TEXT("object was shown or deleted"));
+    }
+    return list + lo;
+}
+
+STATIC mp_obj_t new_obj(int type, mp_int_t x, mp_int_t y, mp_int_t width, mp_int_t height, mp_int_t rgb, arg_t arg)
 {
     uint8_t r = (rgb >> 16) & 0xFF;
     uint8_t g = (rgb >> 8) & 0xFF;
@@ -547,6 +718,7 @@ STATIC void new_obj(int type, mp_int_t x, mp_int_t y, mp_int_t width, mp_int_t h
         (uint8_t)(128.0 - 0.16874 * (r)-0.33126 * (g) + 0.50000 * (b)),
         (uint8_t)(128.0 + 0.50000 * (r)-0.41869 * (g)-0.08131 * (b)),
     };
+    obj_t *list = obj_list();
     obj_t *gfx;
 
     assert(width >= 0);
@@ -557,12 +729,18 @@ STATIC void new_obj(int type, mp_int_t x, mp_int_t y, mp_int_t width, mp_int_t h
         mp_raise_ValueError(MP_ERROR_TEXT("color must be between 0x000000 and 0xFFFFFF"));
     }
 
-    // Get the latest free slot
-    if (obj_num >= LEN(obj_list))
+    // Grow the list when full. m_renew may copy it to a new block, which
+    // stays alive, strings included, by being rooted in display_obj_list.
+    if (obj_num == obj_alloc)
     {
-        mp_raise_OSError(MP_ENOMEM);
+        size_t n = (obj_alloc > 0) ? obj_alloc * 2 : 16;
+
+        list = m_renew(obj_t, list, obj_alloc, n);
+        memset(list + obj_alloc, 0, (n - obj_alloc) * sizeof *list);
+        MP_STATE_VM(display_obj_list) = list;
+        obj_alloc = n;
     }
-    gfx = obj_list + obj_num;
+    gfx = list + obj_num;
 
     // This is the only place where we increment this number.
     obj_num++;
@@ -573,9 +751,61 @@ STATIC void new_obj(int type, mp_int_t x, mp_int_t y, mp_int_t width, mp_int_t h
     gfx->y = y;
     gfx->width = width;
     gfx->height = height;
-    memcpy(gfx->yuv444, yuv444, sizeof yuv444);
+    gfx->yuv422 = yuv422_word(yuv444);
+    gfx->retained = false;
+    gfx->id = obj_next_id++;
     gfx->arg = arg;
+
+    handle_obj_t *handle = m_new_obj(handle_obj_t);
+    handle->base.type = &handle_type;
+    handle->id = gfx->id;
+    return MP_OBJ_FROM_PTR(handle);
+}
+
+// retain() keeps the object on the display across show() until deleted
+STATIC mp_obj_t handle_retain(mp_obj_t self_in)
+{
+    find_obj(self_in)->retained = true;
+    return self_in;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(handle_retain_obj, handle_retain);
+
+// move(x, y) places the top left corner of the object at x, y
+STATIC mp_obj_t handle_move(mp_obj_t self_in, mp_obj_t x_in, mp_obj_t y_in)
+{
+    obj_t *obj = find_obj(self_in);
+
+    obj->x = mp_obj_get_int(x_in);
+    obj->y = mp_obj_get_int(y_in);
+    return mp_const_none;
 }
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(handle_move_obj, handle_move);
+
+// delete() removes the object, the ones after it keep their order
+STATIC mp_obj_t handle_delete(mp_obj_t self_in)
+{
+    obj_t *obj = find_obj(self_in);
+    obj_t *end = obj_list() + obj_num;
+
+    memmove(obj, obj + 1, (end - obj - 1) * sizeof *obj);
+    memset(end - 1, 0, sizeof *obj);
+    obj_num--;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(handle_delete_obj, handle_delete);
+
+STATIC const mp_rom_map_elem_t handle_locals_dict_table[] = {
+    {MP_ROM_QSTR(MP_QSTR_retain), MP_ROM_PTR(&handle_retain_obj)},
+    {MP_ROM_QSTR(MP_QSTR_move), MP_ROM_PTR(&handle_move_obj)},
+    {MP_ROM_QSTR(MP_QSTR_delete), MP_ROM_PTR(&handle_delete_obj)},
+};
+STATIC MP_DEFINE_CONST_DICT(handle_locals_dict, handle_locals_dict_table);
+
+STATIC MP_DEFINE_CONST_OBJ_TYPE(
+    handle_type,
+    MP_QSTR_Object,
+    MP_TYPE_FLAG_NONE,
+    locals_dict, &handle_locals_dict);
 
 STATIC mp_obj_t display_line(size_t argc, mp_obj_t const args[])
 {
@@ -599,8 +829,7 @@ STATIC mp_obj_t display_line(size_t argc, mp_obj_t const args[])
         type = OBJ_RECTANGLE;
     }
 
-    new_obj(type, x, y, width, height, rgb, arg);
-    return mp_const_none;
+    return new_obj(type, x, y, width, height, rgb, arg);
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(display_line_obj, 5, 5, display_line);
 
@@ -613,8 +842,7 @@ STATIC mp_obj_t display_text(size_t argc, mp_obj_t const args[])
     mp_int_t width = get_text_width(arg.ptr, strlen(arg.ptr));
     mp_int_t height = get_text_height();
 
-    new_obj(OBJ_TEXT, x, y, width, height, rgb, arg);
-    return mp_const_none;
+    return new_obj(OBJ_TEXT, x, y, width, height, rgb, arg);
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(display_text_obj, 4, 4, display_text);
 
@@ -623,8 +851,7 @@ STATIC mp_obj_t display_fill(mp_obj_t rgb_in)
     mp_int_t rgb = mp_obj_get_int(rgb_in);
     arg_t none = {0};
 
-    new_obj(OBJ_RECTANGLE, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, rgb, none);
-    return mp_const_none;
+    return new_obj(OBJ_RECTANGLE, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, rgb, none);
 }
 MP_DEFINE_CONST_FUN_OBJ_1(display_fill_obj, display_fill);
 
@@ -637,8 +864,7 @@ STATIC mp_obj_t display_hline(size_t argc, mp_obj_t const args[])
     mp_int_t rgb = mp_obj_get_int(args[3]);
     arg_t none = {0};
 
-    new_obj(OBJ_RECTANGLE, x, y, width, height, rgb, none);
-    return mp_const_none;
+    return new_obj(OBJ_RECTANGLE, x, y, width, height, rgb, none);
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(display_hline_obj, 4, 4, display_hline);
 
@@ -651,8 +877,7 @@ STATIC mp_obj_t display_vline(size_t argc, mp_obj_t const args[])
     mp_int_t rgb = mp_obj_get_int(args[3]);
     arg_t none = {0};
 
-    new_obj(OBJ_RECTANGLE, x, y, width, height, rgb, none);
-    return mp_const_none;
+    return new_obj(OBJ_RECTANGLE, x, y, width, height, rgb, none);
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(display_vline_obj, 4, 4, display_vline);
 
@@ -4,507 +4,997 @@
 
 /* generated by ./txt2cfont */
 
-uint8_t const font_50[] = {
+uint8_t const font_50_spans[] = {
 
 	/* height */ 50,
 
-	/*   */ 12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ! */ 4, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* " */ 12, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* # */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* $ */ 20, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0xF3, 0xFC, 0x3F, 0xCF, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF3, 0x00, 0x3F, 0x0F, 0xC0, 0xFF, 0x0F, 0xFC, 0xFF, 0x00, 0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0xF0, 0xFC, 0x00, 0xCF, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0xF3, 0xFC, 0x3F, 0xCF, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* % */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0xF0, 0x3C, 0x00, 0xFF, 0x0F, 0xFC, 0xFF, 0xC0, 0xFF, 0x0F, 0xFC, 0xFF, 0xC0, 0xCF, 0x03, 0x3F, 0x3C, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x3C, 0xFC, 0xC0, 0xF3, 0x03, 0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0xFF, 0x3F, 0xF0, 0xFF, 0x00, 0x3C, 0x0F, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* & */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xFF, 0x03, 0xF0, 0x3F, 0xC0, 0xCF, 0x0F, 0xFC, 0xFC, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0xCF, 0x0F, 0xFC, 0xFC, 0x00, 0xFF, 0x03, 0xF0, 0x3F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xFF, 0xF3, 0xF0, 0x3F, 0xCF, 0xFF, 0xF3, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0x3F, 0xFC, 0xFF, 0xC0, 0x3F, 0x0F, 0xFC, 0xF3, 0x00, 0x3F, 0x0F, 0xF0, 0xF3, 0x00, 0x3F, 0x0F, 0xF0, 0xF3, 0xC0, 0xFF, 0x0F, 0xFC, 0xFF, 0xC3, 0xFF, 0x3F, 0xFC, 0xCF, 0xFF, 0xF3, 0xFC, 0x3F, 0x0F, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ' */ 4, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ( */ 12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xFC, 0xC0, 0x0F, 0x3F, 0xF0, 0xC3, 0x0F, 0xFC, 0xC0, 0x03, 0x3C, 0xF0, 0x03, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0x3C, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFC, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ) */ 12, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0x3F, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFC, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0xC0, 0x0F, 0x3F, 0xF0, 0xC3, 0x0F, 0xFC, 0xF0, 0x03, 0x3F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* * */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0xF3, 0xFC, 0x3F, 0xCF, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0xF3, 0xFC, 0x3F, 0xCF, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* + */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* , */ 8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0x3C, 0x3C, 0x0F, 0x0F, 0x00, 0x00, 0x00,
-	/* - */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* . */ 8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* / */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x03, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x03, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 0 */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xC3, 0x03, 0x3C, 0x3C, 0xC0, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 1 */ 12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0xC0, 0x0F, 0xFC, 0xC0, 0x0F, 0xFC, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 2 */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 3 */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 4 */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0xC0, 0xFF, 0x00, 0xFC, 0x0F, 0xF0, 0xF3, 0x00, 0x3F, 0x0F, 0xFC, 0xF0, 0xC0, 0x0F, 0x0F, 0x3F, 0xF0, 0xF0, 0x03, 0xCF, 0x0F, 0xF0, 0xFC, 0x00, 0xFF, 0x03, 0xF0, 0x3F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 5 */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF, 0x03, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 6 */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 7 */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x03, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 8 */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0xC3, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 9 */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xF0, 0x3F, 0x00, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* : */ 8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ; */ 8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0x3C, 0x3C, 0x0F, 0x0F, 0x00, 0x00, 0x00,
-	/* < */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* = */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* > */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ? */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* @ */ 28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x3F, 0xFC, 0xFF, 0xFF, 0xF3, 0x03, 0x00, 0xFC, 0x3F, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xF0, 0x0F, 0xFF, 0x0F, 0xFF, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xFF, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xFF, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xFF, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xFF, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xFF, 0xF0, 0xF0, 0xFC, 0x0F, 0x0F, 0xCF, 0xFF, 0xF0, 0xFF, 0x3F, 0x0F, 0xFF, 0xFF, 0xF3, 0xC0, 0xFF, 0x0F, 0x0F, 0xFC, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* A */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0xC0, 0x0F, 0x3F, 0xFC, 0xF0, 0xC3, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* B */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* C */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* D */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* E */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* F */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* G */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* H */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* I */ 8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* J */ 16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x03, 0x3C, 0x03, 0x3C, 0x0F, 0x3F, 0x0F, 0x3F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFC, 0x03, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* K */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0x3F, 0x0F, 0xF0, 0xF3, 0xC0, 0x0F, 0x0F, 0xFC, 0xF0, 0xF0, 0x03, 0x0F, 0x3F, 0xF0, 0xFC, 0x00, 0xCF, 0x0F, 0xF0, 0x3F, 0x00, 0xFF, 0x03, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x3F, 0x00, 0xFF, 0x03, 0xF0, 0xFC, 0x00, 0xCF, 0x0F, 0xF0, 0xF0, 0x03, 0x0F, 0x3F, 0xF0, 0xC0, 0x0F, 0x0F, 0xFC, 0xF0, 0x00, 0x3F, 0x0F, 0xF0, 0xF3, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* L */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* M */ 28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0xFC, 0x3F, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0x3F, 0xC0, 0xFF, 0xFF, 0x03, 0xFC, 0xFF, 0x3C, 0xC0, 0xF3, 0xCF, 0x03, 0x3C, 0xFF, 0xFC, 0xF0, 0xF3, 0xCF, 0x0F, 0x3F, 0xFF, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xFF, 0xF0, 0xFF, 0xF0, 0x0F, 0xFF, 0x0F, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* N */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0xFF, 0x03, 0xF0, 0x3F, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x3C, 0xF0, 0xCF, 0x03, 0xFF, 0x3C, 0xF0, 0xCF, 0x03, 0xFF, 0x3C, 0xF0, 0xCF, 0x03, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0xC0, 0xF3, 0x0F, 0x3C, 0xFF, 0xC0, 0xF3, 0x0F, 0x3C, 0xFF, 0xC0, 0xF3, 0x0F, 0x3C, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* O */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* P */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Q */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF, 0xF3, 0xFF, 0x3F, 0xFF, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* R */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0xCF, 0x0F, 0xF0, 0xF0, 0x03, 0x0F, 0x3F, 0xF0, 0xC0, 0x0F, 0x0F, 0xFC, 0xF0, 0x00, 0x3F, 0x0F, 0xF0, 0xF3, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* S */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xC0, 0xFF, 0x0F, 0xFC, 0xFF, 0x00, 0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* T */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* U */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* V */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0x0F, 0x3F, 0xFC, 0xF0, 0x03, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* W */ 28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0xF0, 0xFF, 0xF0, 0x0F, 0xFF, 0x0F, 0xFF, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xFF, 0xFC, 0xF0, 0xF3, 0xCF, 0x0F, 0x3F, 0xFF, 0x3C, 0xC0, 0xF3, 0xCF, 0x03, 0x3C, 0xFF, 0x3F, 0xC0, 0xFF, 0xFF, 0x03, 0xFC, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0xFC, 0x3F, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* X */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0x0F, 0x3F, 0xFC, 0xF0, 0x03, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0xC0, 0x0F, 0x3F, 0xFC, 0xF0, 0xC3, 0x03, 0x3C, 0x3C, 0xC0, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Y */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0x0F, 0x3F, 0xFC, 0xF0, 0x03, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Z */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x03, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x03, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* [ */ 12, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* \ */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xC0, 0x03, 0x00, 0x3C, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x03, 0x00, 0x3C, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ] */ 12, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ^ */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0x0F, 0x3F, 0xFC, 0xF0, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* _ */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ` */ 12, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0x3F, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFC, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* a */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0x3F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xF3, 0xF0, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* b */ 20, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xFC, 0x0F, 0xCF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFC, 0x0F, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* c */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* d */ 20, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF3, 0xF0, 0x3F, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xCF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* e */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xC0, 0xFF, 0x0F, 0xFC, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* f */ 20, 0x00, 0xFF, 0x0F, 0xFC, 0xFF, 0xC0, 0xFF, 0x0F, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* g */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0xF0, 0x3F, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xF3, 0xF0, 0x3F, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F,
-	/* h */ 20, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xFC, 0x0F, 0xCF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* i */ 8, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* j */ 16, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x03, 0x3C, 0x03, 0x3C, 0x0F, 0x3F, 0x0F, 0x3F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFC, 0x03,
-	/* k */ 20, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0x3F, 0x0F, 0xF0, 0xF3, 0xC0, 0x0F, 0x0F, 0xFC, 0xF0, 0xF0, 0x03, 0x0F, 0x3F, 0xF0, 0xFC, 0x00, 0xCF, 0x0F, 0xF0, 0x3F, 0x00, 0xFF, 0x03, 0xF0, 0x3F, 0x00, 0xFF, 0x03, 0xF0, 0xFC, 0x00, 0xCF, 0x0F, 0xF0, 0xF0, 0x03, 0x0F, 0x3F, 0xF0, 0xC0, 0x0F, 0x0F, 0xFC, 0xF0, 0x00, 0x3F, 0x0F, 0xF0, 0xF3, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* l */ 8, 0x3F, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* m */ 28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0xF0, 0x0F, 0xCF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3, 0xC3, 0x3F, 0xFC, 0x3F, 0xFC, 0xC3, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* n */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x0F, 0xCF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* o */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* p */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x0F, 0xCF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFC, 0x0F, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00,
-	/* q */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0xF0, 0x3F, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xF3, 0xF0, 0x3F, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0,
-	/* r */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* s */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0xC0, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0x30, 0x0F, 0x00, 0xF3, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xC0, 0xFF, 0x0F, 0xFC, 0xFF, 0x00, 0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0xCF, 0x00, 0xF0, 0x0C, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* t */ 18, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xF3, 0xFF, 0x0F, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x0F, 0x0C, 0x3F, 0x30, 0xF0, 0xFF, 0xC0, 0xFF, 0x03, 0xFC, 0x03, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* u */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xF3, 0xF0, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* v */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xCF, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0x03, 0x3C, 0x3C, 0xC0, 0x03, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* w */ 28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0xC3, 0x3F, 0xFC, 0x3F, 0xFC, 0xC3, 0xFF, 0xC3, 0x3F, 0xFC, 0x3F, 0xFC, 0xC3, 0xCF, 0xC3, 0x3F, 0x3C, 0x3C, 0xFC, 0xC3, 0xC3, 0xC3, 0x3F, 0x3C, 0x3C, 0xFC, 0xC3, 0xC3, 0xC3, 0x3F, 0x3C, 0x3C, 0xFC, 0xC3, 0xC3, 0xC3, 0x3F, 0x3C, 0x3C, 0xFC, 0xC3, 0xC3, 0xFF, 0xFF, 0x3F, 0xFC, 0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x3C, 0xC0, 0x03, 0xC0, 0x03, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* x */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0x03, 0x3C, 0x3C, 0xC0, 0xC3, 0x0F, 0x3F, 0xFC, 0xF0, 0x03, 0x0F, 0x0F, 0xF0, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0x3F, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0x0F, 0xF0, 0xF0, 0xC0, 0x0F, 0x3F, 0xFC, 0xF0, 0xC3, 0x03, 0x3C, 0x3C, 0xC0, 0xF3, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* y */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xF3, 0xF0, 0x3F, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x0F, 0xC0, 0xCF, 0xFF, 0x3F, 0xFC, 0xFF, 0x03, 0xFF, 0x0F,
-	/* z */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* { */ 10, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xF0, 0xF3, 0xCF, 0x3F, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0xC3, 0x03, 0x0F, 0x3C, 0xF0, 0x00, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0xFF, 0xFC, 0xC3, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* | */ 4, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* } */ 10, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x3F, 0xFC, 0xF3, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0xCF, 0x3F, 0xFF, 0xFC, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ~ */ 20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0xF0, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0x0F, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/*   */ 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ! */ 4, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 48, 48, 48, 48, 48, 48, 50, 52, 54, 56, 58, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* " */ 12, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4,
+	/* # */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 34, 36, 38, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 90, 92, 94, 96, 100, 104, 108, 112, 116, 120, 124, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 0, 20, 0, 20, 0, 20, 0, 20, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 0, 20, 0, 20, 0, 20, 0, 20, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4,
+	/* $ */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 20, 26, 32, 38, 42, 46, 50, 54, 58, 62, 66, 70, 72, 74, 76, 78, 82, 86, 90, 94, 98, 102, 106, 110, 116, 122, 128, 134, 136, 138, 140, 142, 144, 146, 148, 150, 150, 150, 150, 150, 150, 150, 150, 8, 4, 8, 4, 8, 4, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 8, 4, 14, 6, 0, 6, 8, 4, 14, 6, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 6, 8, 4, 0, 6, 8, 4, 2, 14, 2, 14, 4, 14, 4, 14, 8, 4, 14, 6, 8, 4, 14, 6, 8, 4, 16, 4, 8, 4, 16, 4, 8, 4, 16, 4, 8, 4, 16, 4, 8, 4, 16, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 6, 8, 4, 14, 6, 0, 6, 8, 4, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* % */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 76, 80, 84, 88, 92, 96, 100, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 2, 4, 16, 4, 2, 4, 16, 4, 0, 8, 14, 6, 0, 8, 14, 6, 0, 8, 14, 6, 0, 8, 14, 6, 2, 4, 12, 6, 2, 4, 12, 6, 12, 6, 12, 6, 10, 6, 10, 6, 10, 6, 10, 6, 8, 6, 8, 6, 8, 6, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 6, 4, 6, 4, 6, 4, 6, 2, 6, 2, 6, 2, 6, 14, 4, 2, 6, 14, 4, 0, 6, 12, 8, 0, 6, 12, 8, 0, 6, 12, 8, 0, 6, 12, 8, 0, 4, 14, 4, 0, 4, 14, 4,
+	/* & */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 6, 6, 6, 6, 4, 10, 4, 10, 2, 6, 10, 6, 2, 6, 10, 6, 2, 4, 12, 4, 2, 4, 12, 4, 2, 4, 12, 4, 2, 4, 12, 4, 2, 6, 10, 6, 2, 6, 10, 6, 4, 10, 4, 10, 6, 6, 6, 6, 4, 10, 16, 4, 4, 10, 16, 4, 2, 12, 16, 4, 2, 12, 16, 4, 0, 6, 10, 10, 0, 6, 10, 10, 0, 4, 10, 8, 0, 4, 10, 8, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 10, 10, 0, 4, 10, 10, 0, 6, 10, 10, 0, 6, 10, 10, 2, 12, 16, 4, 2, 12, 16, 4, 4, 8, 16, 4, 4, 8, 16, 4,
+	/* ' */ 4, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* ( */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 8, 4, 8, 4, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 2, 4, 2, 4, 0, 6, 0, 6, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 2, 4, 2, 4, 2, 6, 2, 6, 4, 6, 4, 6, 6, 6, 6, 6, 8, 4, 8, 4,
+	/* ) */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 4, 0, 4, 0, 6, 0, 6, 2, 6, 2, 6, 4, 6, 4, 6, 6, 6, 6, 6, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 0, 6, 0, 6, 0, 4, 0, 4,
+	/* * */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 14, 20, 26, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 62, 68, 74, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 8, 4, 8, 4, 8, 4, 8, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 6, 8, 4, 14, 6, 0, 6, 8, 4, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12, 6, 8, 6, 8, 6, 8, 6, 8, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 8, 4, 14, 6, 0, 6, 8, 4, 14, 6, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* + */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 0, 20, 0, 20, 0, 20, 0, 20, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* , */ 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 32, 32, 32, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 6, 2, 6, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 2, 4, 0, 4, 0, 4,
+	/* - */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* . */ 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 4, 2, 4,
+	/* / */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 16, 4, 16, 4, 16, 4, 16, 4, 14, 6, 14, 6, 14, 4, 14, 4, 12, 6, 12, 6, 12, 4, 12, 4, 10, 6, 10, 6, 10, 4, 10, 4, 8, 4, 8, 4, 8, 4, 8, 4, 6, 4, 6, 4, 4, 6, 4, 6, 4, 4, 4, 4, 2, 6, 2, 6, 2, 4, 2, 4, 0, 6, 0, 6, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* 0 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 62, 68, 74, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 130, 132, 134, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 4, 12, 4, 12, 2, 16, 2, 16, 2, 4, 14, 4, 2, 4, 14, 4, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* 1 */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 4, 4, 4, 4, 4, 4, 4, 2, 6, 2, 6, 2, 6, 2, 6, 0, 8, 0, 8, 0, 8, 0, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 12, 0, 12, 0, 12, 0, 12,
+	/* 2 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 16, 4, 16, 4, 14, 6, 14, 6, 12, 6, 12, 6, 10, 6, 10, 6, 8, 6, 8, 6, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 0, 6, 0, 6, 0, 4, 0, 4, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* 3 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 68, 72, 76, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 14, 6, 14, 6, 4, 14, 4, 14, 4, 14, 4, 14, 14, 6, 14, 6, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* 4 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 16, 4, 16, 4, 14, 6, 14, 6, 12, 8, 12, 8, 10, 10, 10, 10, 8, 6, 16, 4, 8, 6, 16, 4, 6, 6, 16, 4, 6, 6, 16, 4, 4, 6, 16, 4, 4, 6, 16, 4, 2, 6, 16, 4, 2, 6, 16, 4, 0, 6, 16, 4, 0, 6, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 20, 0, 20, 0, 20, 0, 20, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4,
+	/* 5 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 60, 64, 68, 72, 74, 76, 78, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 0, 20, 0, 20, 0, 20, 0, 20, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 16, 0, 16, 0, 18, 0, 18, 14, 6, 14, 6, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* 6 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 98, 100, 102, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 16, 0, 16, 0, 18, 0, 18, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* 7 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 20, 0, 20, 0, 20, 0, 20, 16, 4, 16, 4, 16, 4, 16, 4, 14, 6, 14, 6, 14, 4, 14, 4, 12, 6, 12, 6, 12, 4, 12, 4, 10, 6, 10, 6, 10, 4, 10, 4, 8, 6, 8, 6, 8, 4, 8, 4, 6, 6, 6, 6, 6, 4, 6, 4, 4, 6, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	/* 8 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 114, 116, 118, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* 9 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 84, 88, 92, 96, 98, 100, 102, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 16, 4, 0, 6, 16, 4, 2, 18, 2, 18, 4, 16, 4, 16, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* : */ 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 20, 22, 24, 26, 28, 30, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 4, 2, 4, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 4, 2, 4,
+	/* ; */ 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 48, 48, 48, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 4, 2, 4, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 6, 2, 6, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 2, 4, 0, 4, 0, 4,
+	/* < */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 16, 4, 16, 4, 14, 6, 14, 6, 12, 6, 12, 6, 10, 6, 10, 6, 8, 6, 8, 6, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 0, 6, 0, 6, 0, 6, 0, 6, 2, 6, 2, 6, 4, 6, 4, 6, 6, 6, 6, 6, 8, 6, 8, 6, 10, 6, 10, 6, 12, 6, 12, 6, 14, 6, 14, 6, 16, 4, 16, 4,
+	/* = */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10, 12, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 20, 0, 20, 0, 20, 0, 20, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* > */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 4, 0, 4, 0, 6, 0, 6, 2, 6, 2, 6, 4, 6, 4, 6, 6, 6, 6, 6, 8, 6, 8, 6, 10, 6, 10, 6, 12, 6, 12, 6, 14, 6, 14, 6, 14, 6, 14, 6, 12, 6, 12, 6, 10, 6, 10, 6, 8, 6, 8, 6, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 0, 6, 0, 6, 0, 4, 0, 4,
+	/* ? */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 68, 68, 68, 68, 70, 72, 74, 76, 78, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 16, 4, 16, 4, 14, 6, 14, 6, 12, 6, 12, 6, 10, 6, 10, 6, 8, 6, 8, 6, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* @ */ 28, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 30, 36, 42, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120, 128, 136, 144, 148, 152, 156, 160, 162, 164, 166, 168, 170, 172, 174, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 4, 20, 4, 20, 2, 24, 2, 24, 0, 6, 22, 6, 0, 6, 22, 6, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 10, 10, 24, 4, 0, 4, 10, 10, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 22, 6, 0, 4, 8, 4, 16, 4, 22, 6, 0, 4, 8, 18, 0, 4, 8, 18, 0, 4, 10, 14, 0, 4, 10, 14, 0, 4, 0, 4, 0, 6, 0, 6, 2, 22, 2, 22, 4, 20, 4, 20,
+	/* A */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 74, 76, 78, 80, 84, 88, 92, 96, 100, 104, 108, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 8, 4, 8, 4, 8, 4, 8, 4, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 4, 12, 4, 12, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 2, 6, 12, 6, 2, 6, 12, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 16, 2, 16, 0, 20, 0, 20, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* B */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 114, 116, 118, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 0, 16, 0, 16, 0, 18, 0, 18, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 18, 0, 18, 0, 18, 0, 18, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 18, 0, 18, 0, 16, 0, 16,
+	/* C */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 68, 72, 76, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* D */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 122, 124, 126, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 16, 0, 16, 0, 18, 0, 18, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 18, 0, 18, 0, 16, 0, 16,
+	/* E */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 20, 0, 20, 0, 20, 0, 20, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 16, 0, 16, 0, 16, 0, 16, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* F */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 20, 0, 20, 0, 20, 0, 20, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 16, 0, 16, 0, 16, 0, 16, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* G */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 98, 100, 102, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* H */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 66, 68, 70, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 132, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 20, 0, 20, 0, 20, 0, 20, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* I */ 8, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 8, 0, 8, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 0, 8, 0, 8,
+	/* J */ 16, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 60, 64, 68, 72, 74, 76, 78, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 8, 8, 8, 8, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 0, 2, 10, 4, 0, 2, 10, 4, 0, 4, 8, 6, 0, 4, 8, 6, 0, 12, 0, 12, 2, 8, 2, 8,
+	/* K */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 66, 68, 70, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 10, 6, 0, 4, 10, 6, 0, 4, 8, 6, 0, 4, 8, 6, 0, 4, 6, 6, 0, 4, 6, 6, 0, 10, 0, 10, 0, 8, 0, 8, 0, 8, 0, 8, 0, 10, 0, 10, 0, 4, 6, 6, 0, 4, 6, 6, 0, 4, 8, 6, 0, 4, 8, 6, 0, 4, 10, 6, 0, 4, 10, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* L */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* M */ 28, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 48, 56, 64, 72, 80, 88, 94, 100, 106, 112, 118, 124, 130, 136, 142, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 0, 4, 24, 4, 0, 4, 24, 4, 0, 6, 22, 6, 0, 6, 22, 6, 0, 8, 20, 8, 0, 8, 20, 8, 0, 8, 20, 8, 0, 8, 20, 8, 0, 10, 18, 10, 0, 10, 18, 10, 0, 4, 6, 4, 18, 4, 24, 4, 0, 4, 6, 4, 18, 4, 24, 4, 0, 4, 6, 6, 16, 6, 24, 4, 0, 4, 6, 6, 16, 6, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4,
+	/* N */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 38, 44, 50, 56, 62, 68, 74, 80, 86, 92, 98, 104, 110, 116, 122, 128, 134, 140, 146, 152, 156, 160, 164, 168, 172, 176, 180, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 0, 6, 16, 4, 0, 6, 16, 4, 0, 6, 16, 4, 0, 6, 16, 4, 0, 8, 16, 4, 0, 8, 16, 4, 0, 8, 16, 4, 0, 8, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 12, 8, 0, 4, 12, 8, 0, 4, 12, 8, 0, 4, 12, 8, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 14, 6,
+	/* O */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 122, 124, 126, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* P */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 0, 16, 0, 16, 0, 18, 0, 18, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 18, 0, 18, 0, 16, 0, 16, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* Q */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 110, 116, 120, 124, 126, 128, 130, 132, 134, 136, 138, 140, 140, 140, 140, 140, 140, 140, 140, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 6, 8, 12, 0, 6, 8, 12, 2, 16, 2, 16, 4, 14, 4, 14, 14, 6, 14, 6, 16, 4, 16, 4,
+	/* R */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 74, 76, 78, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 16, 0, 16, 0, 18, 0, 18, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 18, 0, 18, 0, 16, 0, 16, 0, 4, 6, 6, 0, 4, 6, 6, 0, 4, 8, 6, 0, 4, 8, 6, 0, 4, 10, 6, 0, 4, 10, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* S */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 68, 72, 76, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 6, 0, 6, 2, 14, 2, 14, 4, 14, 4, 14, 14, 6, 14, 6, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* T */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 20, 0, 20, 0, 20, 0, 20, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* U */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 130, 132, 134, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* V */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 6, 12, 6, 2, 6, 12, 6, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 12, 4, 12, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 8, 4, 8, 4,
+	/* W */ 28, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 46, 52, 58, 64, 70, 76, 82, 88, 94, 100, 108, 116, 124, 132, 140, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 6, 6, 16, 6, 24, 4, 0, 4, 6, 6, 16, 6, 24, 4, 0, 4, 6, 4, 18, 4, 24, 4, 0, 4, 6, 4, 18, 4, 24, 4, 0, 10, 18, 10, 0, 10, 18, 10, 0, 8, 20, 8, 0, 8, 20, 8, 0, 8, 20, 8, 0, 8, 20, 8, 0, 6, 22, 6, 0, 6, 22, 6, 0, 4, 24, 4, 0, 4, 24, 4,
+	/* X */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 66, 68, 70, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 6, 12, 6, 2, 6, 12, 6, 4, 4, 12, 4, 4, 4, 12, 4, 4, 12, 4, 12, 6, 8, 6, 8, 6, 8, 6, 8, 4, 12, 4, 12, 4, 4, 12, 4, 4, 4, 12, 4, 2, 6, 12, 6, 2, 6, 12, 6, 2, 4, 14, 4, 2, 4, 14, 4, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* Y */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 6, 12, 6, 2, 6, 12, 6, 4, 4, 12, 4, 4, 4, 12, 4, 4, 12, 4, 12, 6, 8, 6, 8, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* Z */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 20, 0, 20, 0, 20, 0, 20, 14, 6, 14, 6, 14, 4, 14, 4, 12, 6, 12, 6, 12, 4, 12, 4, 10, 6, 10, 6, 10, 4, 10, 4, 8, 4, 8, 4, 8, 4, 8, 4, 6, 4, 6, 4, 4, 6, 4, 6, 4, 4, 4, 4, 2, 6, 2, 6, 2, 4, 2, 4, 0, 6, 0, 6, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* [ */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 12, 0, 12, 0, 12, 0, 12, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 12, 0, 12, 0, 12, 0, 12,
+	/* \ */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 4, 0, 4, 0, 4, 0, 4, 0, 6, 0, 6, 2, 4, 2, 4, 2, 6, 2, 6, 4, 4, 4, 4, 4, 6, 4, 6, 6, 4, 6, 4, 8, 4, 8, 4, 8, 4, 8, 4, 10, 4, 10, 4, 10, 6, 10, 6, 12, 4, 12, 4, 12, 6, 12, 6, 14, 4, 14, 4, 14, 6, 14, 6, 16, 4, 16, 4, 16, 4, 16, 4,
+	/* ] */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 12, 0, 12, 0, 12, 0, 12, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 0, 12, 0, 12, 0, 12, 0, 12,
+	/* ^ */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 16, 20, 24, 28, 32, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 8, 4, 8, 4, 6, 8, 6, 8, 4, 12, 4, 12, 2, 6, 12, 6, 2, 6, 12, 6, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* _ */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 8, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* ` */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 4, 0, 4, 0, 6, 0, 6, 2, 6, 2, 6, 4, 6, 4, 6, 6, 6, 6, 6, 8, 4, 8, 4,
+	/* a */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 44, 48, 52, 56, 60, 64, 68, 72, 74, 76, 80, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 4, 16, 4, 16, 2, 18, 2, 18, 0, 6, 16, 4, 0, 6, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 10, 16, 4, 4, 10, 16, 4,
+	/* b */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 26, 30, 32, 34, 38, 42, 46, 50, 54, 58, 62, 66, 70, 74, 78, 82, 86, 90, 94, 98, 102, 106, 110, 114, 116, 118, 122, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 6, 10, 0, 4, 6, 10, 0, 18, 0, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 0, 18, 0, 18, 0, 4, 6, 10, 0, 4, 6, 10,
+	/* c */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 52, 56, 60, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* d */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 26, 30, 32, 34, 38, 42, 46, 50, 54, 58, 62, 66, 70, 74, 78, 82, 86, 90, 94, 98, 102, 106, 110, 114, 116, 118, 122, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 4, 10, 16, 4, 4, 10, 16, 4, 2, 18, 2, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 12, 18, 2, 4, 12, 18, 2,
+	/* e */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 20, 0, 20, 0, 20, 0, 20, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 6, 0, 6, 2, 14, 2, 14, 4, 12, 4, 12,
+	/* f */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 8, 12, 6, 14, 6, 14, 4, 6, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 16, 0, 16, 0, 16, 0, 16, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	/* g */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 10, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 94, 96, 100, 104, 106, 108, 110, 112, 114, 116, 120, 124, 126, 128, 130, 4, 10, 16, 4, 4, 10, 16, 4, 2, 18, 2, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 10, 16, 4, 4, 10, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 2, 16, 2, 16, 4, 12,
+	/* h */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 26, 30, 32, 34, 38, 42, 46, 50, 54, 58, 62, 66, 70, 74, 78, 82, 86, 90, 94, 98, 102, 106, 110, 114, 118, 122, 126, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 6, 10, 0, 4, 6, 10, 0, 18, 0, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* i */ 8, 0, 2, 4, 6, 8, 10, 12, 14, 14, 14, 14, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 4, 2, 4, 0, 6, 0, 6, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 0, 8, 0, 8,
+	/* j */ 16, 0, 2, 4, 6, 8, 10, 12, 14, 14, 14, 14, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 82, 86, 90, 94, 96, 98, 100, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 8, 8, 8, 8, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 0, 2, 10, 4, 0, 2, 10, 4, 0, 4, 8, 6, 0, 4, 8, 6, 0, 12, 0, 12, 2, 8,
+	/* k */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 26, 30, 34, 38, 42, 46, 50, 54, 58, 62, 66, 70, 72, 74, 76, 78, 82, 86, 90, 94, 98, 102, 106, 110, 114, 118, 122, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 10, 6, 0, 4, 10, 6, 0, 4, 8, 6, 0, 4, 8, 6, 0, 4, 6, 6, 0, 4, 6, 6, 0, 10, 0, 10, 0, 10, 0, 10, 0, 4, 6, 6, 0, 4, 6, 6, 0, 4, 8, 6, 0, 4, 8, 6, 0, 4, 10, 6, 0, 4, 10, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* l */ 8, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0, 6, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 0, 8, 0, 8,
+	/* m */ 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 12, 14, 16, 22, 28, 34, 40, 46, 52, 58, 64, 70, 76, 82, 88, 94, 100, 106, 112, 118, 124, 130, 136, 142, 148, 154, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0, 4, 6, 6, 16, 8, 0, 4, 6, 6, 16, 8, 0, 26, 0, 26, 0, 6, 10, 8, 22, 6, 0, 6, 10, 8, 22, 6, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4,
+	/* n */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 10, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 0, 4, 6, 10, 0, 4, 6, 10, 0, 18, 0, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* o */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 90, 92, 94, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* p */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 10, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 94, 96, 100, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126, 0, 4, 6, 10, 0, 4, 6, 10, 0, 18, 0, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 0, 18, 0, 18, 0, 4, 6, 10, 0, 4, 6, 10, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* q */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 10, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 94, 96, 100, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126, 4, 10, 16, 4, 4, 10, 16, 4, 2, 18, 2, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 10, 16, 4, 4, 10, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4,
+	/* r */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 0, 4, 6, 14, 0, 4, 6, 14, 0, 20, 0, 20, 0, 8, 0, 8, 0, 6, 0, 6, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* s */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 52, 56, 60, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 2, 0, 4, 16, 2, 0, 4, 0, 4, 0, 6, 0, 6, 2, 14, 2, 14, 4, 14, 4, 14, 14, 6, 14, 6, 16, 4, 16, 4, 2, 2, 16, 4, 2, 2, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* t */ 18, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 70, 74, 76, 78, 80, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 16, 0, 16, 0, 16, 0, 16, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 16, 2, 4, 6, 16, 2, 6, 12, 6, 12, 8, 8, 8, 8,
+	/* u */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 98, 100, 104, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 10, 16, 4, 4, 10, 16, 4,
+	/* v */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 82, 84, 86, 88, 90, 92, 94, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 6, 8, 6, 8, 6, 8, 6, 8, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* w */ 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 72, 78, 84, 90, 96, 102, 108, 114, 120, 122, 124, 128, 132, 136, 140, 144, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 6, 10, 8, 22, 6, 0, 6, 10, 8, 22, 6, 0, 6, 10, 8, 22, 6, 0, 6, 10, 8, 22, 6, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 24, 2, 24, 4, 8, 16, 8, 4, 8, 16, 8, 4, 6, 18, 6, 4, 6, 18, 6, 6, 4, 18, 4, 6, 4, 18, 4,
+	/* x */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 50, 52, 54, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 6, 12, 6, 2, 6, 12, 6, 4, 4, 12, 4, 4, 4, 12, 4, 4, 12, 4, 12, 6, 8, 6, 8, 6, 8, 6, 8, 4, 12, 4, 12, 4, 4, 12, 4, 4, 4, 12, 4, 2, 6, 12, 6, 2, 6, 12, 6, 2, 4, 14, 4, 2, 4, 14, 4, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* y */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 98, 100, 104, 108, 110, 112, 114, 116, 118, 120, 124, 128, 130, 132, 134, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 10, 16, 4, 4, 10, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 2, 16, 2, 16, 4, 12,
+	/* z */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0, 20, 0, 20, 0, 20, 0, 20, 16, 4, 16, 4, 14, 6, 14, 6, 12, 6, 12, 6, 10, 6, 10, 6, 8, 6, 8, 6, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 0, 6, 0, 6, 0, 4, 0, 4, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* { */ 10, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 6, 4, 6, 2, 8, 2, 8, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 0, 4, 0, 4, 0, 4, 0, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 8, 2, 8, 4, 6, 4, 6,
+	/* | */ 4, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* } */ 10, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 6, 0, 6, 0, 8, 0, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 4, 6, 4, 6, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 8, 0, 8, 0, 6, 0, 6,
+	/* ~ */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 2, 8, 16, 4, 2, 8, 16, 4, 0, 12, 16, 4, 0, 12, 16, 4, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 10, 8, 0, 4, 10, 8,
 };
 
-uint8_t const font_26[] = {
+uint16_t const font_50_spans_index[] = {
+	/*   */ 1,
+	/* ! */ 53,
+	/* " */ 165,
+	/* # */ 265,
+	/* $ */ 445,
+	/* % */ 647,
+	/* & */ 803,
+	/* ' */ 983,
+	/* ( */ 1059,
+	/* ) */ 1183,
+	/* * */ 1307,
+	/* + */ 1447,
+	/* , */ 1555,
+	/* - */ 1639,
+	/* . */ 1699,
+	/* / */ 1767,
+	/* 0 */ 1891,
+	/* 1 */ 2079,
+	/* 2 */ 2203,
+	/* 3 */ 2343,
+	/* 4 */ 2483,
+	/* 5 */ 2631,
+	/* 6 */ 2763,
+	/* 7 */ 2919,
+	/* 8 */ 3043,
+	/* 9 */ 3215,
+	/* : */ 3371,
+	/* ; */ 3455,
+	/* < */ 3555,
+	/* = */ 3679,
+	/* > */ 3747,
+	/* ? */ 3871,
+	/* @ */ 4003,
+	/* A */ 4231,
+	/* B */ 4395,
+	/* C */ 4567,
+	/* D */ 4707,
+	/* E */ 4887,
+	/* F */ 5011,
+	/* G */ 5135,
+	/* H */ 5291,
+	/* I */ 5479,
+	/* J */ 5603,
+	/* K */ 5735,
+	/* L */ 5915,
+	/* M */ 6039,
+	/* N */ 6279,
+	/* O */ 6515,
+	/* P */ 6695,
+	/* Q */ 6851,
+	/* R */ 7043,
+	/* S */ 7223,
+	/* T */ 7363,
+	/* U */ 7487,
+	/* V */ 7675,
+	/* W */ 7851,
+	/* X */ 8091,
+	/* Y */ 8271,
+	/* Z */ 8423,
+	/* [ */ 8547,
+	/* \ */ 8671,
+	/* ] */ 8795,
+	/* ^ */ 8919,
+	/* _ */ 9007,
+	/* ` */ 9067,
+	/* a */ 9143,
+	/* b */ 9279,
+	/* c */ 9457,
+	/* d */ 9581,
+	/* e */ 9759,
+	/* f */ 9883,
+	/* g */ 10013,
+	/* h */ 10195,
+	/* i */ 10377,
+	/* j */ 10499,
+	/* k */ 10651,
+	/* l */ 10829,
+	/* m */ 10959,
+	/* n */ 11171,
+	/* o */ 11331,
+	/* p */ 11479,
+	/* q */ 11657,
+	/* r */ 11835,
+	/* s */ 11947,
+	/* t */ 12071,
+	/* u */ 12205,
+	/* v */ 12365,
+	/* w */ 12513,
+	/* x */ 12713,
+	/* y */ 12861,
+	/* z */ 13047,
+	/* { */ 13155,
+	/* | */ 13279,
+	/* } */ 13403,
+	/* ~ */ 13527,
+};
+
+uint8_t const font_26_spans[] = {
 
 	/* height */ 26,
 
-	/*   */ 6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ! */ 2, 0xF0, 0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x00,
-	/* " */ 6, 0x00, 0x30, 0xCF, 0xF3, 0x3C, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* # */ 10, 0x00, 0x00, 0xC0, 0x0C, 0x33, 0xCC, 0x30, 0xF3, 0xFF, 0xFF, 0xCC, 0x30, 0xC3, 0x0C, 0x33, 0xCC, 0x30, 0xF3, 0xFF, 0xFF, 0xCC, 0x30, 0xC3, 0x0C, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* $ */ 10, 0x30, 0xC0, 0xC0, 0x8F, 0x7F, 0xB7, 0xCF, 0x3C, 0xC3, 0x0C, 0x33, 0xDC, 0xE0, 0x0F, 0x7F, 0xB0, 0xC3, 0x0C, 0x33, 0xCC, 0x33, 0xDF, 0xEE, 0x1F, 0x3F, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* % */ 10, 0x00, 0x00, 0x60, 0xF0, 0xE3, 0x8F, 0x1B, 0x07, 0x1C, 0x38, 0xE0, 0xC0, 0x01, 0x07, 0x0E, 0x38, 0x70, 0xC0, 0x81, 0x03, 0x8E, 0x1D, 0x7F, 0xFC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* & */ 10, 0x00, 0x00, 0x80, 0x03, 0x1F, 0xEE, 0x18, 0x63, 0x8C, 0x3B, 0x7C, 0xE0, 0xC0, 0xB7, 0xDF, 0xE7, 0x8F, 0x37, 0xDC, 0x70, 0xE3, 0x9F, 0xEF, 0x37, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ' */ 2, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ( */ 6, 0x00, 0x00, 0xE3, 0x9C, 0x63, 0x1C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x18, 0x0E, 0x87, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ) */ 6, 0x00, 0x30, 0x1C, 0x0E, 0x87, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xE3, 0x9C, 0x73, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* * */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x33, 0xDF, 0xEE, 0x1F, 0x3F, 0x78, 0xE0, 0xC1, 0x8F, 0x7F, 0xB7, 0xCF, 0x0C, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* + */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0xFF, 0xFF, 0x0F, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* , */ 4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xEF, 0xCC, 0x36, 0x00,
-	/* - */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* . */ 4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x6F, 0x00, 0x00, 0x00,
-	/* / */ 10, 0x00, 0x00, 0x00, 0x30, 0xC0, 0x80, 0x03, 0x06, 0x1C, 0x30, 0xE0, 0x80, 0x01, 0x03, 0x0C, 0x18, 0x70, 0xC0, 0x80, 0x03, 0x06, 0x1C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 0 */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x86, 0x1D, 0x3E, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF3, 0xCC, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x87, 0x1B, 0xE6, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 1 */ 6, 0x00, 0xC0, 0x30, 0x8E, 0xF3, 0x3C, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 2 */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x00, 0x03, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0x81, 0x03, 0x07, 0x0C, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 3 */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0xCE, 0x1F, 0x7F, 0x80, 0x03, 0x0C, 0x30, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 4 */ 10, 0x00, 0x00, 0x00, 0x30, 0xE0, 0xC0, 0x83, 0x0F, 0x37, 0xCE, 0x1C, 0x3B, 0x7C, 0xF0, 0xC0, 0xFF, 0xFF, 0x0F, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 5 */ 10, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xCF, 0x7F, 0x80, 0x03, 0x0C, 0x30, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 6 */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xCF, 0x7F, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 7 */ 10, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x03, 0x0C, 0x38, 0x60, 0xC0, 0x01, 0x03, 0x0E, 0x18, 0x70, 0xC0, 0x80, 0x03, 0x06, 0x1C, 0x30, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 8 */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x9F, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* 9 */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEC, 0x3F, 0xFF, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* : */ 4, 0x00, 0x00, 0x00, 0xF6, 0x6F, 0x00, 0x00, 0x00, 0xF6, 0x6F, 0x00, 0x00, 0x00,
-	/* ; */ 4, 0x00, 0x00, 0x00, 0xF6, 0x6F, 0x00, 0x00, 0x00, 0xF6, 0xEF, 0xCC, 0x36, 0x00,
-	/* < */ 10, 0x00, 0x00, 0x00, 0x30, 0xE0, 0xC0, 0x81, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xC0, 0x01, 0x0E, 0x70, 0x80, 0x03, 0x1C, 0xE0, 0x00, 0x07, 0x38, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* = */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* > */ 10, 0x00, 0x00, 0x30, 0xC0, 0x01, 0x0E, 0x70, 0x80, 0x03, 0x1C, 0xE0, 0x00, 0x07, 0x38, 0xE0, 0xC0, 0x81, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ? */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x00, 0x03, 0x0E, 0x1C, 0x38, 0x70, 0xC0, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* @ */ 14, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xF8, 0x7F, 0x07, 0xF8, 0x00, 0x3C, 0x3E, 0xCF, 0xCF, 0x33, 0xF3, 0xCC, 0x3C, 0x33, 0xCF, 0xCC, 0x33, 0xF3, 0xCC, 0x3E, 0xFF, 0x8D, 0x3F, 0x03, 0xC0, 0x01, 0xE0, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* A */ 10, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x78, 0xE0, 0x81, 0x07, 0x3F, 0xCC, 0x30, 0xC3, 0x8C, 0x73, 0x86, 0x19, 0xE6, 0xDF, 0xFF, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* B */ 10, 0x00, 0x00, 0xF0, 0xCF, 0x7F, 0x83, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0xFE, 0xDF, 0x7F, 0x83, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0xFE, 0xDF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* C */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* D */ 10, 0x00, 0x00, 0xF0, 0xCF, 0x7F, 0x83, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0xFE, 0xDF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* E */ 10, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xCF, 0x3F, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* F */ 10, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xCF, 0x3F, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* G */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0xF3, 0xCF, 0x3F, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* H */ 10, 0x00, 0x00, 0x30, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0xFC, 0xFF, 0xFF, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* I */ 4, 0x00, 0x6F, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xF6, 0x00, 0x00, 0x00,
-	/* J */ 8, 0x00, 0x00, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x73, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* K */ 10, 0x00, 0x00, 0x30, 0xF0, 0xC0, 0x83, 0x0F, 0x37, 0xCE, 0x1C, 0x3B, 0x7C, 0xF0, 0xC0, 0x03, 0x1F, 0xEC, 0x30, 0xC7, 0x38, 0xC3, 0x0D, 0x3E, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* L */ 10, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* M */ 14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x1F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0xE1, 0x6F, 0xD8, 0x3B, 0xF7, 0xCC, 0x3C, 0x3F, 0x8F, 0xC7, 0xE3, 0xF1, 0x30, 0x3C, 0x0C, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* N */ 10, 0x00, 0x00, 0x70, 0xF0, 0xC1, 0x0F, 0x3F, 0xBC, 0xF1, 0xC6, 0x1B, 0xCF, 0x3C, 0xF3, 0xCC, 0x33, 0x8F, 0x3D, 0xF6, 0xD8, 0xC3, 0x0F, 0x3F, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* O */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* P */ 10, 0x00, 0x00, 0xF0, 0xCF, 0x7F, 0x83, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xE0, 0xFF, 0xFD, 0x33, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Q */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x33, 0xDF, 0xEF, 0x1F, 0x7F, 0x80, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* R */ 10, 0x00, 0x00, 0xF0, 0xCF, 0x7F, 0x83, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xE0, 0xFF, 0xFD, 0xB3, 0xC3, 0x1C, 0xE3, 0x0C, 0x37, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* S */ 10, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xC0, 0x00, 0x03, 0x1C, 0xE0, 0x0F, 0x7F, 0x80, 0x03, 0x0C, 0x30, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* T */ 10, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* U */ 10, 0x00, 0x00, 0x30, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* V */ 10, 0x00, 0x00, 0x30, 0xF0, 0xC0, 0x03, 0x0F, 0x7C, 0xB8, 0x61, 0x86, 0x19, 0x66, 0x98, 0x73, 0xCC, 0x30, 0xC3, 0x0C, 0x3F, 0x78, 0xE0, 0x81, 0x07, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* W */ 14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC3, 0xC3, 0xF0, 0x78, 0x3C, 0x1E, 0xCF, 0xCF, 0x33, 0xF3, 0xCE, 0xBD, 0x61, 0x7F, 0xF8, 0x0F, 0xFC, 0x03, 0x7F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* X */ 10, 0x00, 0x00, 0x30, 0xF0, 0xC0, 0x03, 0x1F, 0x6E, 0x98, 0x73, 0xCC, 0xF0, 0x83, 0x07, 0x1E, 0xFC, 0x30, 0xE3, 0x9C, 0x61, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Y */ 10, 0x00, 0x00, 0x30, 0xF0, 0xC0, 0x03, 0x1F, 0x6E, 0x98, 0x73, 0xCC, 0xF0, 0x83, 0x07, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Z */ 10, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x80, 0x03, 0x06, 0x1C, 0x30, 0xE0, 0x80, 0x01, 0x03, 0x0C, 0x18, 0x70, 0xC0, 0x80, 0x03, 0x06, 0x1C, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* [ */ 6, 0x00, 0xF0, 0xFF, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* \ */ 10, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x07, 0x18, 0xE0, 0x00, 0x03, 0x1C, 0x60, 0x00, 0x03, 0x0C, 0x60, 0x80, 0x03, 0x0C, 0x70, 0x80, 0x01, 0x0E, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ] */ 6, 0x00, 0xF0, 0xFF, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ^ */ 10, 0x00, 0x00, 0x00, 0x03, 0x1E, 0xFC, 0x38, 0x77, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* _ */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ` */ 6, 0x00, 0x30, 0x1C, 0x0E, 0x87, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* a */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x0C, 0x30, 0xC0, 0xFC, 0xFB, 0x7F, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x3F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* b */ 10, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0xB0, 0xCF, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xFE, 0xDF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* c */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* d */ 10, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0xCC, 0xB7, 0xFF, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x3F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* e */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0xFF, 0xFF, 0x3F, 0xC0, 0x00, 0x03, 0x1C, 0xE0, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* f */ 10, 0xF0, 0xE3, 0xCF, 0x01, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0xC3, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* g */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB7, 0xFF, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x3F, 0xDF, 0x00, 0x03, 0x0C, 0xF0, 0xE0, 0xFE, 0xF1, 0x03,
-	/* h */ 10, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0xB0, 0xCF, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* i */ 4, 0xF6, 0x6F, 0x00, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0xF6, 0x00, 0x00, 0x00,
-	/* j */ 8, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x73, 0x3F, 0x1E,
-	/* k */ 10, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xF0, 0xE0, 0xC3, 0x8D, 0x33, 0xC7, 0x0E, 0x1F, 0x7C, 0xB0, 0xC3, 0x1C, 0xE3, 0x0C, 0x37, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* l */ 4, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xF6, 0x00, 0x00, 0x00,
-	/* m */ 14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xF3, 0xFC, 0x7F, 0xE7, 0xF9, 0x30, 0x3C, 0x0C, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* n */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xCF, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* o */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* p */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xCF, 0x7F, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xFE, 0xDF, 0x3E, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x00,
-	/* q */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB7, 0xFF, 0x87, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x3F, 0xDF, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C,
-	/* r */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x0F, 0x1C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* s */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x7F, 0x87, 0x0F, 0x34, 0xC0, 0x01, 0xFE, 0xF0, 0x07, 0x38, 0xC0, 0x02, 0x1F, 0xEE, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* t */ 9, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0xC1, 0xBF, 0x7F, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x01, 0x03, 0x06, 0x0C, 0x38, 0xE2, 0x87, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* u */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x3F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* v */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0xC0, 0x03, 0x0F, 0x6C, 0x98, 0x61, 0x86, 0x31, 0xC3, 0x0C, 0x33, 0x78, 0xE0, 0x01, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* w */ 14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x7C, 0x9E, 0x9F, 0xE7, 0xE6, 0x99, 0x79, 0x66, 0x9E, 0x99, 0x67, 0xFE, 0x1F, 0xCF, 0xC3, 0xE1, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* x */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0xE1, 0x86, 0x39, 0xC7, 0x0C, 0x3F, 0x78, 0xE0, 0xC1, 0x0F, 0x33, 0xCE, 0x19, 0x76, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* y */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0x03, 0x1F, 0xEE, 0x3F, 0xDF, 0x00, 0x03, 0x0C, 0xF0, 0xE0, 0xFE, 0xF1, 0x03,
-	/* z */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x03, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0x81, 0x03, 0x07, 0x0C, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* { */ 5, 0x00, 0x70, 0x6F, 0x8C, 0x31, 0xC6, 0x8C, 0x61, 0x8C, 0x31, 0xC6, 0x78, 0x0E, 0x00, 0x00, 0x00, 0x00,
-	/* | */ 2, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-	/* } */ 5, 0x00, 0x9C, 0xC7, 0x18, 0x63, 0x8C, 0x61, 0xCC, 0x18, 0x63, 0x8C, 0xBD, 0x03, 0x00, 0x00, 0x00, 0x00,
-	/* ~ */ 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFC, 0xF3, 0xFC, 0xE3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/*   */ 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ! */ 2, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 24, 24, 24, 26, 28, 30, 30, 30, 30, 30, 30, 30, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* " */ 6, 0, 0, 0, 4, 8, 12, 16, 20, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 2, 4, 2, 0, 2, 4, 2, 0, 2, 4, 2, 0, 2, 4, 2, 0, 2, 4, 2, 0, 2, 4, 2,
+	/* # */ 10, 0, 0, 0, 4, 8, 12, 16, 18, 20, 24, 28, 32, 36, 40, 44, 46, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 0, 10, 0, 10, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 0, 10, 0, 10, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+	/* $ */ 10, 0, 2, 4, 6, 8, 14, 20, 24, 28, 32, 36, 38, 40, 44, 48, 52, 56, 62, 68, 70, 72, 74, 76, 76, 76, 76, 76, 4, 2, 4, 2, 2, 6, 1, 8, 0, 3, 4, 2, 7, 3, 0, 2, 4, 2, 8, 2, 0, 2, 4, 2, 0, 2, 4, 2, 0, 2, 4, 2, 0, 3, 4, 2, 1, 7, 2, 7, 4, 2, 7, 3, 4, 2, 8, 2, 4, 2, 8, 2, 4, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 3, 4, 2, 7, 3, 1, 8, 2, 6, 4, 2, 4, 2,
+	/* % */ 10, 0, 0, 0, 4, 8, 12, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 40, 44, 48, 52, 52, 52, 52, 52, 52, 52, 1, 2, 8, 2, 0, 4, 7, 3, 0, 4, 7, 3, 1, 2, 6, 3, 6, 3, 5, 3, 5, 3, 4, 3, 4, 3, 3, 3, 3, 3, 2, 3, 2, 3, 1, 3, 1, 3, 7, 2, 0, 3, 6, 4, 0, 3, 6, 4, 0, 2, 7, 2,
+	/* & */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 22, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 3, 3, 2, 5, 1, 3, 5, 3, 1, 2, 6, 2, 1, 2, 6, 2, 1, 3, 5, 3, 2, 5, 3, 3, 2, 5, 8, 2, 1, 6, 8, 2, 0, 3, 5, 5, 0, 2, 5, 4, 0, 2, 6, 3, 0, 2, 6, 3, 0, 2, 5, 5, 0, 3, 5, 5, 1, 6, 8, 2, 2, 4, 8, 2,
+	/* ' */ 2, 0, 0, 0, 2, 4, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* ( */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 4, 2, 3, 3, 2, 3, 1, 3, 1, 2, 0, 3, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 1, 2, 1, 3, 2, 3, 3, 3, 4, 2,
+	/* ) */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 2, 0, 3, 1, 3, 2, 3, 3, 3, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 3, 3, 2, 3, 1, 3, 0, 3, 0, 2,
+	/* * */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 10, 16, 18, 20, 22, 24, 26, 28, 34, 40, 42, 44, 44, 44, 44, 44, 44, 44, 4, 2, 4, 2, 0, 2, 4, 2, 8, 2, 0, 3, 4, 2, 7, 3, 1, 8, 2, 6, 3, 4, 3, 4, 2, 6, 1, 8, 0, 3, 4, 2, 7, 3, 0, 2, 4, 2, 8, 2, 4, 2, 4, 2,
+	/* + */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 28, 28, 28, 28, 28, 28, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 0, 10, 0, 10, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+	/* , */ 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 16, 16, 1, 2, 0, 4, 0, 4, 1, 3, 2, 2, 2, 2, 1, 2, 0, 2,
+	/* - */ 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 10, 0, 10,
+	/* . */ 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 1, 2, 0, 4, 0, 4, 1, 2,
+	/* / */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 8, 2, 8, 2, 7, 3, 7, 2, 6, 3, 6, 2, 5, 3, 5, 2, 4, 2, 4, 2, 3, 2, 2, 3, 2, 2, 1, 3, 1, 2, 0, 3, 0, 2, 0, 2,
+	/* 0 */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 34, 40, 44, 48, 52, 56, 60, 64, 66, 68, 68, 68, 68, 68, 68, 68, 2, 6, 1, 8, 1, 2, 7, 2, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 2, 7, 2, 1, 8, 2, 6,
+	/* 1 */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 2, 2, 2, 2, 1, 3, 1, 3, 0, 4, 0, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 6, 0, 6,
+	/* 2 */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 44, 44, 44, 44, 44, 44, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 8, 2, 7, 3, 6, 3, 5, 3, 4, 3, 3, 3, 2, 3, 1, 3, 0, 3, 0, 2, 0, 10, 0, 10,
+	/* 3 */ 10, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 36, 40, 42, 44, 44, 44, 44, 44, 44, 44, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 8, 2, 8, 2, 8, 2, 7, 3, 2, 7, 2, 7, 7, 3, 8, 2, 8, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* 4 */ 10, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 34, 36, 38, 40, 42, 44, 46, 48, 48, 48, 48, 48, 48, 48, 8, 2, 7, 3, 6, 4, 5, 5, 4, 3, 8, 2, 3, 3, 8, 2, 2, 3, 8, 2, 1, 3, 8, 2, 0, 3, 8, 2, 0, 2, 8, 2, 0, 10, 0, 10, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2,
+	/* 5 */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 32, 36, 38, 40, 40, 40, 40, 40, 40, 40, 0, 10, 0, 10, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 8, 0, 9, 7, 3, 8, 2, 8, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* 6 */ 10, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 28, 32, 36, 40, 44, 48, 50, 52, 52, 52, 52, 52, 52, 52, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 8, 0, 9, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* 7 */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 10, 0, 10, 8, 2, 8, 2, 7, 3, 7, 2, 6, 3, 6, 2, 5, 3, 5, 2, 4, 3, 4, 2, 3, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2,
+	/* 8 */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 30, 32, 36, 40, 44, 48, 52, 56, 58, 60, 60, 60, 60, 60, 60, 60, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* 9 */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 30, 32, 34, 36, 38, 40, 44, 48, 50, 52, 52, 52, 52, 52, 52, 52, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 8, 2, 1, 9, 2, 8, 8, 2, 8, 2, 8, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* : */ 4, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 10, 12, 14, 16, 16, 16, 16, 16, 16, 16, 1, 2, 0, 4, 0, 4, 1, 2, 1, 2, 0, 4, 0, 4, 1, 2,
+	/* ; */ 4, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 10, 12, 14, 16, 18, 20, 22, 24, 24, 24, 1, 2, 0, 4, 0, 4, 1, 2, 1, 2, 0, 4, 0, 4, 1, 3, 2, 2, 2, 2, 1, 2, 0, 2,
+	/* < */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 8, 2, 7, 3, 6, 3, 5, 3, 4, 3, 3, 3, 2, 3, 1, 3, 0, 3, 0, 3, 1, 3, 2, 3, 3, 3, 4, 3, 5, 3, 6, 3, 7, 3, 8, 2,
+	/* = */ 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 4, 4, 6, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 10, 0, 10, 0, 10, 0, 10,
+	/* > */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 2, 0, 3, 1, 3, 2, 3, 3, 3, 4, 3, 5, 3, 6, 3, 7, 3, 7, 3, 6, 3, 5, 3, 4, 3, 3, 3, 2, 3, 1, 3, 0, 3, 0, 2,
+	/* ? */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 22, 24, 26, 28, 30, 32, 34, 34, 34, 36, 38, 40, 40, 40, 40, 40, 40, 40, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 8, 2, 7, 3, 6, 3, 5, 3, 4, 3, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+	/* @ */ 14, 0, 0, 0, 2, 4, 8, 12, 18, 24, 32, 40, 48, 56, 64, 72, 76, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 2, 10, 1, 12, 0, 3, 11, 3, 0, 2, 12, 2, 0, 2, 5, 5, 12, 2, 0, 2, 4, 6, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 2, 8, 2, 11, 3, 0, 2, 4, 9, 0, 2, 5, 7, 0, 2, 0, 3, 1, 11, 2, 10,
+	/* A */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 16, 20, 24, 28, 32, 36, 38, 40, 44, 48, 52, 56, 56, 56, 56, 56, 56, 56, 4, 2, 4, 2, 3, 4, 3, 4, 3, 4, 2, 6, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 1, 3, 6, 3, 1, 2, 7, 2, 1, 2, 7, 2, 1, 8, 0, 10, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* B */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 30, 32, 36, 40, 44, 48, 52, 56, 58, 60, 60, 60, 60, 60, 60, 60, 0, 8, 0, 9, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 9, 0, 9, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 9, 0, 8,
+	/* C */ 10, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 36, 40, 42, 44, 44, 44, 44, 44, 44, 44, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* D */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 62, 64, 64, 64, 64, 64, 64, 64, 0, 8, 0, 9, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 9, 0, 8,
+	/* E */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 10, 0, 10, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 8, 0, 8, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 10, 0, 10,
+	/* F */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 10, 0, 10, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 8, 0, 8, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* G */ 10, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 28, 32, 36, 40, 44, 48, 50, 52, 52, 52, 52, 52, 52, 52, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 4, 6, 0, 2, 4, 6, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* H */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 34, 36, 40, 44, 48, 52, 56, 60, 64, 68, 68, 68, 68, 68, 68, 68, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 10, 0, 10, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* I */ 4, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 4, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 4,
+	/* J */ 8, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 32, 36, 38, 40, 40, 40, 40, 40, 40, 40, 4, 4, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 0, 1, 5, 2, 0, 2, 4, 3, 0, 6, 1, 4,
+	/* K */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 30, 32, 34, 36, 40, 44, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 2, 6, 3, 0, 2, 5, 3, 0, 2, 4, 3, 0, 2, 3, 3, 0, 5, 0, 4, 0, 4, 0, 5, 0, 2, 3, 3, 0, 2, 4, 3, 0, 2, 5, 3, 0, 2, 6, 3, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* L */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 10, 0, 10,
+	/* M */ 14, 0, 0, 0, 4, 8, 12, 16, 20, 28, 36, 44, 50, 56, 62, 68, 74, 78, 82, 86, 90, 94, 94, 94, 94, 94, 94, 94, 0, 2, 12, 2, 0, 3, 11, 3, 0, 4, 10, 4, 0, 4, 10, 4, 0, 5, 9, 5, 0, 2, 3, 2, 9, 2, 12, 2, 0, 2, 3, 3, 8, 3, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 6, 12, 2, 0, 2, 5, 4, 12, 2, 0, 2, 5, 4, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2,
+	/* N */ 10, 0, 0, 0, 4, 8, 12, 16, 22, 28, 34, 40, 46, 52, 58, 64, 70, 76, 80, 84, 88, 92, 92, 92, 92, 92, 92, 92, 0, 3, 8, 2, 0, 3, 8, 2, 0, 4, 8, 2, 0, 4, 8, 2, 0, 2, 3, 2, 8, 2, 0, 2, 3, 2, 8, 2, 0, 2, 3, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 5, 2, 8, 2, 0, 2, 5, 2, 8, 2, 0, 2, 5, 2, 8, 2, 0, 2, 6, 4, 0, 2, 6, 4, 0, 2, 7, 3, 0, 2, 7, 3,
+	/* O */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 62, 64, 64, 64, 64, 64, 64, 64, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* P */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 38, 40, 42, 44, 46, 48, 50, 52, 52, 52, 52, 52, 52, 52, 0, 8, 0, 9, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 9, 0, 8, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* Q */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 58, 62, 64, 66, 68, 70, 70, 70, 70, 70, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 3, 4, 6, 1, 8, 2, 7, 7, 3, 8, 2,
+	/* R */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 38, 40, 44, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 0, 8, 0, 9, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 9, 0, 8, 0, 2, 3, 3, 0, 2, 4, 3, 0, 2, 5, 3, 0, 2, 6, 3, 0, 2, 7, 3, 0, 2, 8, 2,
+	/* S */ 10, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 36, 40, 42, 44, 44, 44, 44, 44, 44, 44, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 0, 2, 0, 2, 0, 3, 1, 7, 2, 7, 7, 3, 8, 2, 8, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* T */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 10, 0, 10, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+	/* U */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 66, 68, 68, 68, 68, 68, 68, 68, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* V */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 54, 56, 58, 60, 62, 62, 62, 62, 62, 62, 62, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 2, 7, 2, 1, 2, 7, 2, 1, 2, 7, 2, 1, 2, 7, 2, 1, 3, 6, 3, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 6, 3, 4, 3, 4, 3, 4, 4, 2,
+	/* W */ 14, 0, 0, 0, 4, 8, 12, 16, 20, 26, 32, 38, 44, 50, 58, 66, 74, 78, 82, 86, 90, 94, 94, 94, 94, 94, 94, 94, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 5, 4, 12, 2, 0, 2, 5, 4, 12, 2, 0, 2, 4, 6, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 3, 3, 8, 3, 12, 2, 0, 2, 3, 2, 9, 2, 12, 2, 0, 5, 9, 5, 0, 4, 10, 4, 0, 4, 10, 4, 0, 3, 11, 3, 0, 2, 12, 2,
+	/* X */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 30, 32, 34, 36, 40, 44, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 2, 7, 2, 1, 3, 6, 3, 2, 2, 6, 2, 2, 6, 3, 4, 3, 4, 2, 6, 2, 2, 6, 2, 1, 3, 6, 3, 1, 2, 7, 2, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* Y */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 50, 50, 50, 50, 50, 50, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 2, 7, 2, 1, 3, 6, 3, 2, 2, 6, 2, 2, 6, 3, 4, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+	/* Z */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 10, 0, 10, 7, 3, 7, 2, 6, 3, 6, 2, 5, 3, 5, 2, 4, 2, 4, 2, 3, 2, 2, 3, 2, 2, 1, 3, 1, 2, 0, 3, 0, 10, 0, 10,
+	/* [ */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 6, 0, 6, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 6, 0, 6,
+	/* \ */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 2, 0, 2, 0, 3, 1, 2, 1, 3, 2, 2, 2, 3, 3, 2, 4, 2, 4, 2, 5, 2, 5, 3, 6, 2, 6, 3, 7, 2, 7, 3, 8, 2, 8, 2,
+	/* ] */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 6, 0, 6, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 0, 6, 0, 6,
+	/* ^ */ 10, 0, 0, 0, 2, 4, 6, 10, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 4, 2, 3, 4, 2, 6, 1, 3, 6, 3, 0, 3, 7, 3, 0, 2, 8, 2,
+	/* _ */ 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 4, 4, 0, 10, 0, 10,
+	/* ` */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 2, 0, 3, 1, 3, 2, 3, 3, 3, 4, 2,
+	/* a */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 24, 28, 32, 36, 38, 42, 42, 42, 42, 42, 42, 42, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 8, 2, 8, 2, 2, 8, 1, 9, 0, 3, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 5, 8, 2,
+	/* b */ 10, 0, 2, 4, 6, 8, 10, 12, 16, 18, 22, 26, 30, 34, 38, 42, 46, 50, 54, 58, 60, 64, 64, 64, 64, 64, 64, 64, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 3, 5, 0, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 0, 9, 0, 2, 3, 5,
+	/* c */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 28, 32, 34, 36, 36, 36, 36, 36, 36, 36, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* d */ 10, 0, 2, 4, 6, 8, 10, 12, 16, 18, 22, 26, 30, 34, 38, 42, 46, 50, 54, 58, 60, 64, 64, 64, 64, 64, 64, 64, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 2, 5, 8, 2, 1, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 6, 9, 1,
+	/* e */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 8, 12, 16, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 10, 0, 10, 0, 2, 0, 2, 0, 2, 0, 3, 1, 7, 2, 6,
+	/* f */ 10, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 40, 40, 40, 40, 40, 40, 4, 6, 3, 7, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 8, 0, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	/* g */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 6, 10, 14, 18, 22, 26, 30, 34, 38, 42, 46, 48, 52, 54, 56, 58, 62, 64, 66, 2, 5, 8, 2, 1, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 5, 8, 2, 8, 2, 8, 2, 8, 2, 0, 2, 7, 3, 1, 8, 2, 6,
+	/* h */ 10, 0, 2, 4, 6, 8, 10, 12, 16, 18, 22, 26, 30, 34, 38, 42, 46, 50, 54, 58, 62, 66, 66, 66, 66, 66, 66, 66, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 3, 5, 0, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* i */ 4, 0, 2, 4, 6, 8, 8, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 1, 2, 0, 4, 0, 4, 1, 2, 0, 3, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 4,
+	/* j */ 8, 0, 2, 4, 6, 8, 8, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 44, 48, 50, 52, 5, 2, 5, 2, 5, 2, 5, 2, 4, 4, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 0, 1, 5, 2, 0, 2, 4, 3, 0, 6, 1, 4,
+	/* k */ 10, 0, 2, 4, 6, 8, 10, 12, 16, 20, 24, 28, 32, 36, 38, 40, 44, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 2, 6, 3, 0, 2, 5, 3, 0, 2, 4, 3, 0, 2, 3, 3, 0, 5, 0, 5, 0, 2, 3, 3, 0, 2, 4, 3, 0, 2, 5, 3, 0, 2, 6, 3, 0, 2, 7, 3, 0, 2, 8, 2,
+	/* l */ 4, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 40, 40, 40, 40, 40, 40, 0, 3, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 4,
+	/* m */ 14, 0, 0, 0, 0, 0, 0, 0, 6, 8, 14, 20, 26, 32, 38, 44, 50, 56, 62, 68, 74, 80, 80, 80, 80, 80, 80, 80, 0, 2, 3, 3, 8, 4, 0, 13, 0, 3, 5, 4, 11, 3, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2,
+	/* n */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 6, 10, 14, 18, 22, 26, 30, 34, 38, 42, 46, 50, 54, 54, 54, 54, 54, 54, 54, 0, 2, 3, 5, 0, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* o */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 46, 48, 48, 48, 48, 48, 48, 48, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* p */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 6, 10, 14, 18, 22, 26, 30, 34, 38, 42, 46, 48, 52, 54, 56, 58, 60, 62, 64, 0, 2, 3, 5, 0, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 0, 9, 0, 2, 3, 5, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* q */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 6, 10, 14, 18, 22, 26, 30, 34, 38, 42, 46, 48, 52, 54, 56, 58, 60, 62, 64, 2, 5, 8, 2, 1, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 5, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2,
+	/* r */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 30, 30, 30, 30, 30, 30, 0, 2, 3, 7, 0, 10, 0, 4, 0, 3, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* s */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 28, 32, 34, 36, 36, 36, 36, 36, 36, 36, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 1, 0, 2, 0, 3, 1, 7, 2, 7, 7, 3, 8, 2, 1, 1, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* t */ 9, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 38, 40, 42, 42, 42, 42, 42, 42, 42, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 8, 0, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 8, 1, 3, 6, 4, 4,
+	/* u */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 50, 54, 54, 54, 54, 54, 54, 54, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 5, 8, 2,
+	/* v */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 48, 48, 48, 48, 48, 48, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 1, 2, 7, 2, 1, 2, 7, 2, 1, 2, 7, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 3, 4, 3, 4, 4, 2, 4, 2,
+	/* w */ 14, 0, 0, 0, 0, 0, 0, 0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 62, 66, 70, 74, 74, 74, 74, 74, 74, 74, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 3, 5, 4, 11, 3, 0, 3, 5, 4, 11, 3, 1, 2, 5, 4, 11, 2, 1, 2, 5, 4, 11, 2, 1, 2, 5, 4, 11, 2, 1, 2, 5, 4, 11, 2, 1, 12, 2, 4, 8, 4, 2, 3, 9, 3, 3, 2, 9, 2,
+	/* x */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 22, 24, 26, 28, 32, 36, 40, 44, 48, 48, 48, 48, 48, 48, 48, 0, 2, 8, 2, 0, 3, 7, 3, 1, 2, 7, 2, 1, 3, 6, 3, 2, 2, 6, 2, 2, 6, 3, 4, 3, 4, 2, 6, 2, 2, 6, 2, 1, 3, 6, 3, 1, 2, 7, 2, 0, 3, 7, 3, 0, 2, 8, 2,
+	/* y */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 50, 54, 56, 58, 60, 64, 66, 68, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 5, 8, 2, 8, 2, 8, 2, 8, 2, 0, 2, 7, 3, 1, 8, 2, 6,
+	/* z */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 28, 28, 28, 28, 28, 28, 0, 10, 0, 10, 8, 2, 7, 3, 6, 3, 5, 3, 4, 3, 3, 3, 2, 3, 1, 3, 0, 3, 0, 2, 0, 10, 0, 10,
+	/* { */ 5, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 2, 3, 1, 4, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 2, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 4, 2, 3,
+	/* | */ 2, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* } */ 5, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 3, 0, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 4, 0, 3,
+	/* ~ */ 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 1, 4, 8, 2, 0, 6, 8, 2, 0, 2, 4, 6, 0, 2, 5, 4,
 };
 
-uint8_t const font_13[] = {
+uint16_t const font_26_spans_index[] = {
+	/*   */ 1,
+	/* ! */ 29,
+	/* " */ 87,
+	/* # */ 139,
+	/* $ */ 231,
+	/* % */ 335,
+	/* & */ 415,
+	/* ' */ 507,
+	/* ( */ 547,
+	/* ) */ 611,
+	/* * */ 675,
+	/* + */ 747,
+	/* , */ 803,
+	/* - */ 847,
+	/* . */ 879,
+	/* / */ 915,
+	/* 0 */ 979,
+	/* 1 */ 1075,
+	/* 2 */ 1139,
+	/* 3 */ 1211,
+	/* 4 */ 1283,
+	/* 5 */ 1359,
+	/* 6 */ 1427,
+	/* 7 */ 1507,
+	/* 8 */ 1571,
+	/* 9 */ 1659,
+	/* : */ 1739,
+	/* ; */ 1783,
+	/* < */ 1835,
+	/* = */ 1899,
+	/* > */ 1935,
+	/* ? */ 1999,
+	/* @ */ 2067,
+	/* A */ 2183,
+	/* B */ 2267,
+	/* C */ 2355,
+	/* D */ 2427,
+	/* E */ 2519,
+	/* F */ 2583,
+	/* G */ 2647,
+	/* H */ 2727,
+	/* I */ 2823,
+	/* J */ 2887,
+	/* K */ 2955,
+	/* L */ 3047,
+	/* M */ 3111,
+	/* N */ 3233,
+	/* O */ 3353,
+	/* P */ 3445,
+	/* Q */ 3525,
+	/* R */ 3623,
+	/* S */ 3715,
+	/* T */ 3787,
+	/* U */ 3851,
+	/* V */ 3947,
+	/* W */ 4037,
+	/* X */ 4159,
+	/* Y */ 4251,
+	/* Z */ 4329,
+	/* [ */ 4393,
+	/* \ */ 4457,
+	/* ] */ 4521,
+	/* ^ */ 4585,
+	/* _ */ 4631,
+	/* ` */ 4663,
+	/* a */ 4703,
+	/* b */ 4773,
+	/* c */ 4865,
+	/* d */ 4929,
+	/* e */ 5021,
+	/* f */ 5085,
+	/* g */ 5153,
+	/* h */ 5247,
+	/* i */ 5341,
+	/* j */ 5405,
+	/* k */ 5485,
+	/* l */ 5577,
+	/* m */ 5645,
+	/* n */ 5753,
+	/* o */ 5835,
+	/* p */ 5911,
+	/* q */ 6003,
+	/* r */ 6095,
+	/* s */ 6153,
+	/* t */ 6217,
+	/* u */ 6287,
+	/* v */ 6369,
+	/* w */ 6445,
+	/* x */ 6547,
+	/* y */ 6623,
+	/* z */ 6719,
+	/* { */ 6775,
+	/* | */ 6839,
+	/* } */ 6903,
+	/* ~ */ 6967,
+};
+
+uint8_t const font_13_spans[] = {
 
 	/* height */ 13,
 
-	/*   */ 3, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* ! */ 1, 0x7E, 0x03,
-	/* " */ 3, 0x68, 0x0B, 0x00, 0x00, 0x00,
-	/* # */ 5, 0x40, 0xA9, 0xAF, 0x94, 0xFA, 0x4A, 0x01, 0x00, 0x00,
-	/* $ */ 5, 0xC4, 0xD5, 0x52, 0x1C, 0xA5, 0xD5, 0x11, 0x00, 0x00,
-	/* % */ 5, 0x60, 0x4E, 0x84, 0x88, 0x10, 0x39, 0x03, 0x00, 0x00,
-	/* & */ 5, 0x80, 0x28, 0x45, 0x6C, 0x4A, 0xC9, 0x02, 0x00, 0x00,
-	/* ' */ 1, 0x0E, 0x00,
-	/* ( */ 3, 0xA0, 0x92, 0x24, 0x22, 0x00,
-	/* ) */ 3, 0x88, 0x48, 0x92, 0x0A, 0x00,
-	/* * */ 5, 0x00, 0x00, 0x52, 0x1D, 0x71, 0x95, 0x00, 0x00, 0x00,
-	/* + */ 5, 0x00, 0x00, 0x42, 0xC8, 0x27, 0x84, 0x00, 0x00, 0x00,
-	/* , */ 2, 0x00, 0x00, 0x6F, 0x00,
-	/* - */ 5, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00,
-	/* . */ 2, 0x00, 0x00, 0x0F, 0x00,
-	/* / */ 5, 0x00, 0x42, 0x84, 0x88, 0x10, 0x21, 0x00, 0x00, 0x00,
-	/* 0 */ 5, 0xC0, 0xC5, 0x18, 0x6B, 0x8C, 0xD1, 0x01, 0x00, 0x00,
-	/* 1 */ 3, 0x90, 0x26, 0x49, 0x3A, 0x00,
-	/* 2 */ 5, 0xC0, 0xC5, 0x08, 0x11, 0x11, 0xE1, 0x03, 0x00, 0x00,
-	/* 3 */ 5, 0xC0, 0x45, 0x08, 0x1D, 0x84, 0xD1, 0x01, 0x00, 0x00,
-	/* 4 */ 5, 0x00, 0x62, 0x2A, 0xE3, 0x87, 0x10, 0x02, 0x00, 0x00,
-	/* 5 */ 5, 0xE0, 0x87, 0x10, 0x1E, 0x84, 0xD1, 0x01, 0x00, 0x00,
-	/* 6 */ 5, 0xC0, 0xC5, 0x10, 0x5E, 0x8C, 0xD1, 0x01, 0x00, 0x00,
-	/* 7 */ 5, 0xE0, 0x43, 0x88, 0x10, 0x21, 0x42, 0x00, 0x00, 0x00,
-	/* 8 */ 5, 0xC0, 0xC5, 0x18, 0x5D, 0x8C, 0xD1, 0x01, 0x00, 0x00,
-	/* 9 */ 5, 0xC0, 0xC5, 0x18, 0x3D, 0x84, 0xD1, 0x01, 0x00, 0x00,
-	/* : */ 2, 0xC0, 0x03, 0x0F, 0x00,
-	/* ; */ 2, 0xC0, 0x03, 0x6F, 0x00,
-	/* < */ 5, 0x00, 0x22, 0x22, 0x82, 0x20, 0x08, 0x02, 0x00, 0x00,
-	/* = */ 5, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-	/* > */ 5, 0x20, 0x08, 0x82, 0x20, 0x22, 0x22, 0x00, 0x00, 0x00,
-	/* ? */ 5, 0xC0, 0xC5, 0x08, 0x11, 0x01, 0x84, 0x00, 0x00, 0x00,
-	/* @ */ 7, 0x00, 0x5F, 0xB0, 0x5B, 0xAD, 0x56, 0x7B, 0x01, 0x1F, 0x00, 0x00, 0x00,
-	/* A */ 5, 0x80, 0x10, 0xA5, 0x62, 0xFC, 0x31, 0x02, 0x00, 0x00,
-	/* B */ 5, 0xE0, 0xC5, 0x18, 0x5F, 0x8C, 0xF1, 0x01, 0x00, 0x00,
-	/* C */ 5, 0xC0, 0xC5, 0x10, 0x42, 0x08, 0xD1, 0x01, 0x00, 0x00,
-	/* D */ 5, 0xE0, 0xC5, 0x18, 0x63, 0x8C, 0xF1, 0x01, 0x00, 0x00,
-	/* E */ 5, 0xE0, 0x87, 0x10, 0x5E, 0x08, 0xE1, 0x03, 0x00, 0x00,
-	/* F */ 5, 0xE0, 0x87, 0x10, 0x5E, 0x08, 0x21, 0x00, 0x00, 0x00,
-	/* G */ 5, 0xC0, 0xC5, 0x10, 0x42, 0x8F, 0xD1, 0x01, 0x00, 0x00,
-	/* H */ 5, 0x20, 0xC6, 0x18, 0x7F, 0x8C, 0x31, 0x02, 0x00, 0x00,
-	/* I */ 3, 0xB8, 0x24, 0x49, 0x3A, 0x00,
-	/* J */ 5, 0xC0, 0x23, 0x84, 0x10, 0x42, 0xC9, 0x00, 0x00, 0x00,
-	/* K */ 5, 0x20, 0xC6, 0x54, 0x46, 0x49, 0x31, 0x02, 0x00, 0x00,
-	/* L */ 5, 0x20, 0x84, 0x10, 0x42, 0x08, 0xE1, 0x03, 0x00, 0x00,
-	/* M */ 7, 0x80, 0xE0, 0xB8, 0x5A, 0x4D, 0x06, 0x83, 0xC1, 0x20, 0x00, 0x00, 0x00,
-	/* N */ 5, 0x20, 0xCE, 0x59, 0x6B, 0xCD, 0x39, 0x02, 0x00, 0x00,
-	/* O */ 5, 0xC0, 0xC5, 0x18, 0x63, 0x8C, 0xD1, 0x01, 0x00, 0x00,
-	/* P */ 5, 0xE0, 0xC5, 0x18, 0xE3, 0x0B, 0x21, 0x00, 0x00, 0x00,
-	/* Q */ 5, 0xC0, 0xC5, 0x18, 0x63, 0x8C, 0xD5, 0x41, 0x00, 0x00,
-	/* R */ 5, 0xE0, 0xC5, 0x18, 0xE3, 0x2B, 0x29, 0x02, 0x00, 0x00,
-	/* S */ 5, 0xC0, 0xC5, 0x10, 0x1C, 0x84, 0xD1, 0x01, 0x00, 0x00,
-	/* T */ 5, 0xE0, 0x13, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00, 0x00,
-	/* U */ 5, 0x20, 0xC6, 0x18, 0x63, 0x8C, 0xD1, 0x01, 0x00, 0x00,
-	/* V */ 5, 0x20, 0xC6, 0x18, 0x95, 0x52, 0x84, 0x00, 0x00, 0x00,
-	/* W */ 7, 0x80, 0x60, 0x30, 0x18, 0x4C, 0x56, 0xAB, 0xE3, 0x20, 0x00, 0x00, 0x00,
-	/* X */ 5, 0x20, 0x46, 0xA5, 0x88, 0x52, 0x31, 0x02, 0x00, 0x00,
-	/* Y */ 5, 0x20, 0x46, 0xA5, 0x08, 0x21, 0x84, 0x00, 0x00, 0x00,
-	/* Z */ 5, 0xE0, 0x43, 0x84, 0x88, 0x10, 0xE1, 0x03, 0x00, 0x00,
-	/* [ */ 3, 0x78, 0x92, 0x24, 0x39, 0x00,
-	/* \ */ 5, 0x20, 0x04, 0x21, 0x08, 0x42, 0x10, 0x02, 0x00, 0x00,
-	/* ] */ 3, 0x38, 0x49, 0x92, 0x3C, 0x00,
-	/* ^ */ 5, 0x80, 0xA8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* _ */ 5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-	/* ` */ 3, 0x88, 0x08, 0x00, 0x00, 0x00,
-	/* a */ 5, 0x00, 0x00, 0x07, 0xA1, 0x8F, 0xD1, 0x03, 0x00, 0x00,
-	/* b */ 5, 0x21, 0x84, 0x17, 0x63, 0x8C, 0xF1, 0x01, 0x00, 0x00,
-	/* c */ 5, 0x00, 0x00, 0x17, 0x43, 0x08, 0xD1, 0x01, 0x00, 0x00,
-	/* d */ 5, 0x10, 0x42, 0x1F, 0x63, 0x8C, 0xD1, 0x03, 0x00, 0x00,
-	/* e */ 5, 0x00, 0x00, 0x17, 0xE3, 0x0F, 0xC1, 0x01, 0x00, 0x00,
-	/* f */ 5, 0x5C, 0x08, 0xF1, 0x84, 0x10, 0x42, 0x00, 0x00, 0x00,
-	/* g */ 5, 0x00, 0x00, 0x1F, 0x63, 0x8C, 0xD1, 0x43, 0xF8, 0x00,
-	/* h */ 5, 0x21, 0x84, 0x17, 0x63, 0x8C, 0x31, 0x02, 0x00, 0x00,
-	/* i */ 3, 0x12, 0x26, 0x49, 0x3A, 0x00,
-	/* j */ 4, 0x88, 0xC0, 0x88, 0x88, 0x88, 0x98, 0x06,
-	/* k */ 5, 0x21, 0x84, 0x98, 0xCA, 0x28, 0x29, 0x02, 0x00, 0x00,
-	/* l */ 5, 0x86, 0x10, 0x42, 0x08, 0x21, 0xC4, 0x01, 0x00, 0x00,
-	/* m */ 7, 0x00, 0x00, 0xE0, 0x96, 0x4C, 0x26, 0x93, 0xC9, 0x24, 0x00, 0x00, 0x00,
-	/* n */ 5, 0x00, 0x80, 0x17, 0x63, 0x8C, 0x31, 0x02, 0x00, 0x00,
-	/* o */ 5, 0x00, 0x00, 0x17, 0x63, 0x8C, 0xD1, 0x01, 0x00, 0x00,
-	/* p */ 5, 0x00, 0x80, 0x17, 0x63, 0x8C, 0xF1, 0x85, 0x10, 0x00,
-	/* q */ 5, 0x00, 0x00, 0x1F, 0x63, 0x8C, 0xD1, 0x43, 0x08, 0x01,
-	/* r */ 5, 0x00, 0x80, 0x3E, 0x42, 0x08, 0x21, 0x00, 0x00, 0x00,
-	/* s */ 5, 0x00, 0x00, 0x1F, 0x82, 0x83, 0xF0, 0x01, 0x00, 0x00,
-	/* t */ 5, 0x42, 0x88, 0x27, 0x84, 0x10, 0x82, 0x03, 0x00, 0x00,
-	/* u */ 5, 0x00, 0x80, 0x18, 0x63, 0x8C, 0xD1, 0x03, 0x00, 0x00,
-	/* v */ 5, 0x00, 0x80, 0x18, 0xA3, 0x52, 0x8A, 0x00, 0x00, 0x00,
-	/* w */ 7, 0x00, 0x00, 0x20, 0x98, 0x4C, 0x26, 0x93, 0x49, 0x1B, 0x00, 0x00, 0x00,
-	/* x */ 5, 0x00, 0x80, 0x18, 0x15, 0x51, 0x31, 0x02, 0x00, 0x00,
-	/* y */ 5, 0x00, 0x80, 0x18, 0x63, 0x8C, 0xD1, 0x43, 0xF8, 0x00,
-	/* z */ 5, 0x00, 0x80, 0x0F, 0x11, 0x11, 0xE1, 0x03, 0x00, 0x00,
-	/* { */ 4, 0xC0, 0x22, 0x12, 0x22, 0xC2, 0x00, 0x00,
-	/* | */ 1, 0xFE, 0x03,
-	/* } */ 4, 0x30, 0x44, 0x84, 0x44, 0x34, 0x00, 0x00,
-	/* ~ */ 5, 0x00, 0x00, 0x20, 0x6B, 0x02, 0x00, 0x00, 0x00, 0x00,
+	/*   */ 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ! */ 1, 0, 0, 2, 4, 6, 8, 10, 12, 12, 14, 16, 16, 16, 16, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* " */ 3, 0, 0, 4, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* # */ 5, 0, 0, 4, 8, 10, 14, 18, 22, 24, 28, 32, 32, 32, 32, 1, 1, 3, 1, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1, 1, 1, 3, 1,
+	/* $ */ 5, 0, 2, 4, 10, 14, 18, 20, 24, 28, 34, 36, 38, 38, 38, 2, 1, 1, 3, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 0, 1, 2, 1, 1, 3, 2, 1, 4, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 1, 3, 2, 1,
+	/* % */ 5, 0, 0, 4, 8, 10, 12, 14, 16, 18, 22, 26, 26, 26, 26, 0, 2, 4, 1, 0, 2, 4, 1, 3, 1, 3, 1, 2, 1, 1, 1, 1, 1, 0, 1, 3, 2, 0, 1, 3, 2,
+	/* & */ 5, 0, 0, 2, 6, 10, 12, 16, 20, 24, 28, 32, 32, 32, 32, 2, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1, 1, 2, 4, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2, 4, 1,
+	/* ' */ 1, 0, 0, 2, 4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 1, 0, 1, 0, 1,
+	/* ( */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 2, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1, 2, 1,
+	/* ) */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 0, 1,
+	/* * */ 5, 0, 0, 0, 0, 2, 8, 10, 12, 14, 20, 22, 22, 22, 22, 2, 1, 0, 1, 2, 1, 4, 1, 1, 3, 2, 1, 1, 3, 0, 1, 2, 1, 4, 1, 2, 1,
+	/* + */ 5, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 14, 14, 14, 2, 1, 2, 1, 2, 1, 0, 5, 2, 1, 2, 1, 2, 1,
+	/* , */ 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 0, 2, 0, 2, 1, 1, 0, 1,
+	/* - */ 5, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 5,
+	/* . */ 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 4, 0, 2, 0, 2,
+	/* / */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 4, 1, 4, 1, 3, 1, 3, 1, 2, 1, 1, 1, 1, 1, 0, 1, 0, 1,
+	/* 0 */ 5, 0, 0, 2, 6, 10, 14, 20, 24, 28, 32, 34, 34, 34, 34, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* 1 */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 1, 1, 1, 1, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* 2 */ 5, 0, 0, 2, 6, 10, 12, 14, 16, 18, 20, 22, 22, 22, 22, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 4, 1, 3, 1, 2, 1, 1, 1, 0, 1, 0, 5,
+	/* 3 */ 5, 0, 0, 2, 6, 8, 10, 12, 14, 16, 20, 22, 22, 22, 22, 1, 3, 0, 1, 4, 1, 4, 1, 4, 1, 1, 3, 4, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* 4 */ 5, 0, 0, 2, 4, 8, 12, 16, 18, 20, 22, 24, 24, 24, 24, 4, 1, 3, 2, 2, 1, 4, 1, 1, 1, 4, 1, 0, 1, 4, 1, 0, 5, 4, 1, 4, 1, 4, 1,
+	/* 5 */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 18, 20, 20, 20, 20, 0, 5, 0, 1, 0, 1, 0, 1, 0, 4, 4, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* 6 */ 5, 0, 0, 2, 6, 8, 10, 12, 16, 20, 24, 26, 26, 26, 26, 1, 3, 0, 1, 4, 1, 0, 1, 0, 1, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* 7 */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 5, 4, 1, 4, 1, 3, 1, 3, 1, 2, 1, 2, 1, 1, 1, 1, 1,
+	/* 8 */ 5, 0, 0, 2, 6, 10, 14, 16, 20, 24, 28, 30, 30, 30, 30, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* 9 */ 5, 0, 0, 2, 6, 10, 14, 16, 18, 20, 24, 26, 26, 26, 26, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4, 4, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* : */ 2, 0, 0, 0, 0, 2, 4, 4, 4, 4, 6, 8, 8, 8, 8, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* ; */ 2, 0, 0, 0, 0, 2, 4, 4, 4, 4, 6, 8, 10, 12, 12, 0, 2, 0, 2, 0, 2, 0, 2, 1, 1, 0, 1,
+	/* < */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 4, 1, 3, 1, 2, 1, 1, 1, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1,
+	/* = */ 5, 0, 0, 0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 4, 4, 0, 5, 0, 5,
+	/* > */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 3, 1, 2, 1, 1, 1, 0, 1,
+	/* ? */ 5, 0, 0, 2, 6, 10, 12, 14, 16, 16, 18, 20, 20, 20, 20, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 4, 1, 3, 1, 2, 1, 2, 1, 2, 1,
+	/* @ */ 7, 0, 0, 2, 6, 12, 20, 28, 36, 40, 42, 44, 44, 44, 44, 1, 5, 0, 1, 6, 1, 0, 1, 2, 3, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 2, 4, 0, 1, 1, 5,
+	/* A */ 5, 0, 0, 2, 4, 8, 12, 16, 20, 22, 26, 30, 30, 30, 30, 2, 1, 2, 1, 1, 1, 3, 1, 1, 1, 3, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 5, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* B */ 5, 0, 0, 2, 6, 10, 14, 16, 20, 24, 28, 30, 30, 30, 30, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4,
+	/* C */ 5, 0, 0, 2, 6, 8, 10, 12, 14, 16, 20, 22, 22, 22, 22, 1, 3, 0, 1, 4, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 1, 1, 3,
+	/* D */ 5, 0, 0, 2, 6, 10, 14, 18, 22, 26, 30, 32, 32, 32, 32, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4,
+	/* E */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 5, 0, 1, 0, 1, 0, 1, 0, 4, 0, 1, 0, 1, 0, 1, 0, 5,
+	/* F */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 5, 0, 1, 0, 1, 0, 1, 0, 4, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* G */ 5, 0, 0, 2, 6, 8, 10, 12, 16, 20, 24, 26, 26, 26, 26, 1, 3, 0, 1, 4, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 3, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* H */ 5, 0, 0, 4, 8, 12, 16, 18, 22, 26, 30, 34, 34, 34, 34, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 5, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* I */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* J */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 18, 20, 20, 20, 20, 1, 4, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* K */ 5, 0, 0, 4, 8, 12, 16, 18, 22, 26, 30, 34, 34, 34, 34, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 3, 1, 0, 1, 2, 1, 0, 2, 0, 1, 2, 1, 0, 1, 3, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* L */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 5,
+	/* M */ 7, 0, 0, 4, 8, 16, 24, 30, 34, 38, 42, 46, 46, 46, 46, 0, 1, 6, 1, 0, 2, 5, 2, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 6, 1, 0, 1, 6, 1, 0, 1, 6, 1, 0, 1, 6, 1,
+	/* N */ 5, 0, 0, 4, 8, 12, 18, 24, 30, 34, 38, 42, 42, 42, 42, 0, 1, 4, 1, 0, 2, 4, 1, 0, 2, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 3, 2, 0, 1, 3, 2, 0, 1, 4, 1,
+	/* O */ 5, 0, 0, 2, 6, 10, 14, 18, 22, 26, 30, 32, 32, 32, 32, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* P */ 5, 0, 0, 2, 6, 10, 14, 18, 20, 22, 24, 26, 26, 26, 26, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4, 0, 1, 0, 1, 0, 1,
+	/* Q */ 5, 0, 0, 2, 6, 10, 14, 18, 22, 26, 32, 34, 36, 36, 36, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 2, 1, 4, 1, 1, 3, 4, 1,
+	/* R */ 5, 0, 0, 2, 6, 10, 14, 18, 20, 24, 28, 32, 32, 32, 32, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4, 0, 1, 2, 1, 0, 1, 3, 1, 0, 1, 4, 1,
+	/* S */ 5, 0, 0, 2, 6, 8, 10, 12, 14, 16, 20, 22, 22, 22, 22, 1, 3, 0, 1, 4, 1, 0, 1, 0, 1, 1, 3, 4, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* T */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 5, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+	/* U */ 5, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 34, 34, 34, 34, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* V */ 5, 0, 0, 4, 8, 12, 16, 20, 24, 28, 30, 32, 32, 32, 32, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1, 2, 1,
+	/* W */ 7, 0, 0, 4, 8, 12, 16, 22, 30, 38, 42, 46, 46, 46, 46, 0, 1, 6, 1, 0, 1, 6, 1, 0, 1, 6, 1, 0, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 2, 5, 2, 0, 1, 6, 1,
+	/* X */ 5, 0, 0, 4, 8, 12, 16, 18, 22, 26, 30, 34, 34, 34, 34, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1, 1, 1, 3, 1, 1, 1, 3, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* Y */ 5, 0, 0, 4, 8, 12, 16, 18, 20, 22, 24, 26, 26, 26, 26, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+	/* Z */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 5, 4, 1, 3, 1, 3, 1, 2, 1, 1, 1, 1, 1, 0, 1, 0, 5,
+	/* [ */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 3, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3,
+	/* \ */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 1, 0, 1, 1, 1, 1, 1, 2, 1, 3, 1, 3, 1, 4, 1, 4, 1,
+	/* ] */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 3, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 0, 3,
+	/* ^ */ 5, 0, 0, 2, 6, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 2, 1, 1, 1, 3, 1, 0, 1, 4, 1,
+	/* _ */ 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 5,
+	/* ` */ 3, 0, 0, 2, 4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 1, 1, 1, 2, 1,
+	/* a */ 5, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 18, 18, 18, 18, 1, 3, 4, 1, 4, 1, 1, 4, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4,
+	/* b */ 5, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 30, 30, 30, 30, 0, 1, 0, 1, 0, 1, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4,
+	/* c */ 5, 0, 0, 0, 0, 2, 6, 8, 10, 12, 16, 18, 18, 18, 18, 1, 3, 0, 1, 4, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 1, 1, 3,
+	/* d */ 5, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 30, 30, 30, 30, 4, 1, 4, 1, 4, 1, 1, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4,
+	/* e */ 5, 0, 0, 0, 0, 2, 6, 10, 12, 14, 16, 18, 18, 18, 18, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 5, 0, 1, 0, 1, 1, 3,
+	/* f */ 5, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 20, 20, 20, 2, 3, 1, 1, 1, 1, 1, 1, 0, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* g */ 5, 0, 0, 0, 0, 2, 6, 10, 14, 18, 22, 24, 26, 28, 30, 1, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4, 4, 1, 4, 1, 0, 4,
+	/* h */ 5, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 32, 32, 32, 0, 1, 0, 1, 0, 1, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* i */ 3, 0, 2, 4, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 1, 1, 1, 1, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* j */ 4, 0, 2, 4, 4, 6, 8, 10, 12, 14, 16, 18, 20, 24, 26, 3, 1, 3, 1, 2, 2, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* k */ 5, 0, 2, 4, 6, 10, 14, 18, 20, 24, 28, 32, 32, 32, 32, 0, 1, 0, 1, 0, 1, 0, 1, 4, 1, 0, 1, 3, 1, 0, 1, 2, 1, 0, 2, 0, 1, 2, 1, 0, 1, 3, 1, 0, 1, 4, 1,
+	/* l */ 5, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 20, 20, 20, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 3,
+	/* m */ 7, 0, 0, 0, 0, 4, 10, 16, 22, 28, 34, 40, 40, 40, 40, 0, 3, 4, 2, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1,
+	/* n */ 5, 0, 0, 0, 0, 2, 6, 10, 14, 18, 22, 26, 26, 26, 26, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* o */ 5, 0, 0, 0, 0, 2, 6, 10, 14, 18, 22, 24, 24, 24, 24, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* p */ 5, 0, 0, 0, 0, 2, 6, 10, 14, 18, 22, 24, 26, 28, 30, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4, 0, 1, 0, 1, 0, 1,
+	/* q */ 5, 0, 0, 0, 0, 2, 6, 10, 14, 18, 22, 24, 26, 28, 30, 1, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4, 4, 1, 4, 1, 4, 1,
+	/* r */ 5, 0, 0, 0, 0, 4, 6, 8, 10, 12, 14, 16, 16, 16, 16, 0, 1, 2, 3, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* s */ 5, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 14, 14, 14, 1, 4, 0, 1, 0, 1, 1, 3, 4, 1, 4, 1, 0, 4,
+	/* t */ 5, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 20, 20, 20, 1, 1, 1, 1, 1, 1, 0, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3,
+	/* u */ 5, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 26, 26, 26, 26, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4,
+	/* v */ 5, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 26, 26, 26, 26, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1,
+	/* w */ 7, 0, 0, 0, 0, 4, 10, 16, 22, 28, 34, 38, 38, 38, 38, 0, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 1, 2, 4, 2,
+	/* x */ 5, 0, 0, 0, 0, 4, 8, 12, 14, 18, 22, 26, 26, 26, 26, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 2, 1, 1, 1, 3, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* y */ 5, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 26, 28, 30, 32, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4, 4, 1, 4, 1, 0, 4,
+	/* z */ 5, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 14, 14, 14, 0, 5, 4, 1, 3, 1, 2, 1, 1, 1, 0, 1, 0, 5,
+	/* { */ 4, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 2, 2, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+	/* | */ 1, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* } */ 4, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 2, 2, 1, 2, 1, 2, 1, 3, 1, 2, 1, 2, 1, 2, 1, 0, 2,
+	/* ~ */ 5, 0, 0, 0, 0, 0, 4, 10, 14, 14, 14, 14, 14, 14, 14, 1, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 3, 1,
+};
+
+uint16_t const font_13_spans_index[] = {
+	/*   */ 1,
+	/* ! */ 16,
+	/* " */ 47,
+	/* # */ 74,
+	/* $ */ 121,
+	/* % */ 174,
+	/* & */ 215,
+	/* ' */ 262,
+	/* ( */ 283,
+	/* ) */ 316,
+	/* * */ 349,
+	/* + */ 386,
+	/* , */ 415,
+	/* - */ 438,
+	/* . */ 455,
+	/* / */ 474,
+	/* 0 */ 507,
+	/* 1 */ 556,
+	/* 2 */ 589,
+	/* 3 */ 626,
+	/* 4 */ 663,
+	/* 5 */ 702,
+	/* 6 */ 737,
+	/* 7 */ 778,
+	/* 8 */ 811,
+	/* 9 */ 856,
+	/* : */ 897,
+	/* ; */ 920,
+	/* < */ 947,
+	/* = */ 980,
+	/* > */ 999,
+	/* ? */ 1032,
+	/* @ */ 1067,
+	/* A */ 1126,
+	/* B */ 1171,
+	/* C */ 1216,
+	/* D */ 1253,
+	/* E */ 1300,
+	/* F */ 1333,
+	/* G */ 1366,
+	/* H */ 1407,
+	/* I */ 1456,
+	/* J */ 1489,
+	/* K */ 1524,
+	/* L */ 1573,
+	/* M */ 1606,
+	/* N */ 1667,
+	/* O */ 1724,
+	/* P */ 1771,
+	/* Q */ 1812,
+	/* R */ 1863,
+	/* S */ 1910,
+	/* T */ 1947,
+	/* U */ 1980,
+	/* V */ 2029,
+	/* W */ 2076,
+	/* X */ 2137,
+	/* Y */ 2186,
+	/* Z */ 2227,
+	/* [ */ 2260,
+	/* \ */ 2293,
+	/* ] */ 2326,
+	/* ^ */ 2359,
+	/* _ */ 2384,
+	/* ` */ 2401,
+	/* a */ 2422,
+	/* b */ 2455,
+	/* c */ 2500,
+	/* d */ 2533,
+	/* e */ 2578,
+	/* f */ 2611,
+	/* g */ 2646,
+	/* h */ 2691,
+	/* i */ 2738,
+	/* j */ 2771,
+	/* k */ 2812,
+	/* l */ 2859,
+	/* m */ 2894,
+	/* n */ 2949,
+	/* o */ 2990,
+	/* p */ 3029,
+	/* q */ 3074,
+	/* r */ 3119,
+	/* s */ 3150,
+	/* t */ 3179,
+	/* u */ 3214,
+	/* v */ 3255,
+	/* w */ 3296,
+	/* x */ 3349,
+	/* y */ 3390,
+	/* z */ 3437,
+	/* { */ 3466,
+	/* | */ 3499,
+	/* } */ 3532,
+	/* ~ */ 3565,
 };
 
-uint8_t const font_7[] = {
+uint8_t const font_7_spans[] = {
 
 	/* height */ 7,
 
-	/*   */ 1, 0x00,
-	/* ! */ 1, 0x17,
-	/* " */ 3, 0x2D, 0x00, 0x00,
-	/* # */ 5, 0xEA, 0xAB, 0xAF, 0x00, 0x00,
-	/* $ */ 3, 0xFA, 0x7C, 0x01,
-	/* % */ 3, 0xA5, 0x52, 0x00,
-	/* & */ 3, 0xAA, 0x6A, 0x00,
-	/* ' */ 1, 0x03,
-	/* ( */ 2, 0x56, 0x02,
-	/* ) */ 2, 0xA9, 0x01,
-	/* * */ 2, 0x0F, 0x00,
-	/* + */ 3, 0xD0, 0x05, 0x00,
-	/* , */ 1, 0x30,
-	/* - */ 3, 0xC0, 0x01, 0x00,
-	/* . */ 1, 0x10,
-	/* / */ 3, 0xA4, 0x94, 0x00,
-	/* 0 */ 3, 0x6F, 0x7B, 0x00,
-	/* 1 */ 3, 0x9A, 0x74, 0x00,
-	/* 2 */ 3, 0xE7, 0x73, 0x00,
-	/* 3 */ 3, 0xE7, 0x79, 0x00,
-	/* 4 */ 3, 0xED, 0x49, 0x00,
-	/* 5 */ 3, 0xCF, 0x79, 0x00,
-	/* 6 */ 3, 0xCF, 0x7B, 0x00,
-	/* 7 */ 3, 0x27, 0x49, 0x00,
-	/* 8 */ 3, 0xEF, 0x7B, 0x00,
-	/* 9 */ 3, 0xEF, 0x79, 0x00,
-	/* : */ 1, 0x12,
-	/* ; */ 1, 0x32,
-	/* < */ 3, 0x54, 0x44, 0x00,
-	/* = */ 3, 0x38, 0x0E, 0x00,
-	/* > */ 3, 0x11, 0x15, 0x00,
-	/* ? */ 3, 0xA7, 0x20, 0x00,
-	/* @ */ 4, 0x9F, 0xDD, 0xF1, 0x00,
-	/* A */ 3, 0x6F, 0x5F, 0x00,
-	/* B */ 3, 0xEB, 0x3A, 0x00,
-	/* C */ 3, 0x4F, 0x72, 0x00,
-	/* D */ 3, 0x6B, 0x3B, 0x00,
-	/* E */ 3, 0xCF, 0x73, 0x00,
-	/* F */ 3, 0xCF, 0x13, 0x00,
-	/* G */ 3, 0x4F, 0x7A, 0x00,
-	/* H */ 3, 0xED, 0x5B, 0x00,
-	/* I */ 3, 0x97, 0x74, 0x00,
-	/* J */ 3, 0x24, 0x7B, 0x00,
-	/* K */ 3, 0xED, 0x5A, 0x00,
-	/* L */ 3, 0x49, 0x72, 0x00,
-	/* M */ 5, 0x71, 0xD7, 0x18, 0x01, 0x00,
-	/* N */ 4, 0xB9, 0xDF, 0x09, 0x00,
-	/* O */ 3, 0x6F, 0x7B, 0x00,
-	/* P */ 3, 0xEF, 0x13, 0x00,
-	/* Q */ 3, 0x6F, 0x7F, 0x02,
-	/* R */ 3, 0xEF, 0x5A, 0x00,
-	/* S */ 3, 0x8F, 0x78, 0x00,
-	/* T */ 3, 0x97, 0x24, 0x00,
-	/* U */ 3, 0x6D, 0x7B, 0x00,
-	/* V */ 3, 0x6D, 0x2B, 0x00,
-	/* W */ 5, 0x31, 0xD6, 0x1D, 0x01, 0x00,
-	/* X */ 3, 0xAD, 0x5A, 0x00,
-	/* Y */ 3, 0xAD, 0x24, 0x00,
-	/* Z */ 3, 0xA7, 0x72, 0x00,
-	/* [ */ 2, 0x57, 0x03,
-	/* \ */ 3, 0x89, 0x44, 0x02,
-	/* ] */ 2, 0xAB, 0x03,
-	/* ^ */ 3, 0x2A, 0x00, 0x00,
-	/* _ */ 3, 0x00, 0x80, 0x03,
-	/* ` */ 3, 0x11, 0x01, 0x00,
-	/* a */ 3, 0x38, 0x7F, 0x00,
-	/* b */ 3, 0x79, 0x7B, 0x00,
-	/* c */ 3, 0x78, 0x72, 0x00,
-	/* d */ 3, 0x7C, 0x7B, 0x00,
-	/* e */ 3, 0xF8, 0x73, 0x00,
-	/* f */ 3, 0xD6, 0x25, 0x00,
-	/* g */ 3, 0x78, 0x7B, 0x1E,
-	/* h */ 3, 0x79, 0x5B, 0x00,
-	/* i */ 1, 0x1D,
-	/* j */ 2, 0xA2, 0x3A,
-	/* k */ 3, 0xE9, 0x56, 0x00,
-	/* l */ 2, 0x55, 0x03,
-	/* m */ 5, 0xE0, 0xD7, 0x5A, 0x01, 0x00,
-	/* n */ 3, 0x78, 0x5B, 0x00,
-	/* o */ 3, 0x78, 0x7B, 0x00,
-	/* p */ 3, 0x78, 0xFB, 0x04,
-	/* q */ 3, 0x78, 0x7B, 0x12,
-	/* r */ 3, 0x78, 0x12, 0x00,
-	/* s */ 3, 0x78, 0x78, 0x00,
-	/* t */ 3, 0xBA, 0x64, 0x00,
-	/* u */ 3, 0x68, 0x7B, 0x00,
-	/* v */ 3, 0x68, 0x2B, 0x00,
-	/* w */ 5, 0xA0, 0xD6, 0xFA, 0x01, 0x00,
-	/* x */ 3, 0xA8, 0x54, 0x00,
-	/* y */ 3, 0x68, 0x7B, 0x1E,
-	/* z */ 3, 0x38, 0x73, 0x00,
-	/* { */ 3, 0xD6, 0x64, 0x00,
-	/* | */ 1, 0x3F,
-	/* } */ 3, 0x93, 0x35, 0x00,
-	/* ~ */ 4, 0x00, 0xC3, 0x00, 0x00,
+	/*   */ 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ! */ 1, 0, 2, 4, 6, 6, 8, 8, 8, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* " */ 3, 0, 4, 8, 8, 8, 8, 8, 8, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* # */ 5, 0, 4, 6, 10, 12, 16, 16, 16, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1,
+	/* $ */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 1, 1, 0, 3, 0, 2, 1, 2, 0, 3, 1, 1,
+	/* % */ 3, 0, 4, 6, 8, 10, 14, 14, 14, 0, 1, 2, 1, 2, 1, 1, 1, 0, 1, 0, 1, 2, 1,
+	/* & */ 3, 0, 2, 6, 8, 12, 14, 14, 14, 1, 1, 0, 1, 2, 1, 1, 1, 0, 1, 2, 1, 1, 2,
+	/* ' */ 1, 0, 2, 4, 4, 4, 4, 4, 4, 0, 1, 0, 1,
+	/* ( */ 2, 0, 2, 4, 6, 8, 10, 10, 10, 1, 1, 0, 1, 0, 1, 0, 1, 1, 1,
+	/* ) */ 2, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+	/* * */ 2, 0, 2, 4, 4, 4, 4, 4, 4, 0, 2, 0, 2,
+	/* + */ 3, 0, 0, 2, 4, 6, 6, 6, 6, 1, 1, 0, 3, 1, 1,
+	/* , */ 1, 0, 0, 0, 0, 0, 2, 4, 4, 0, 1, 0, 1,
+	/* - */ 3, 0, 0, 0, 2, 2, 2, 2, 2, 0, 3,
+	/* . */ 1, 0, 0, 0, 0, 0, 2, 2, 2, 0, 1,
+	/* / */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 2, 1, 2, 1, 1, 1, 1, 1, 0, 1, 0, 1,
+	/* 0 */ 3, 0, 2, 6, 10, 14, 16, 16, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* 1 */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 1, 1, 0, 2, 1, 1, 1, 1, 0, 3,
+	/* 2 */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 2, 1, 0, 3, 0, 1, 0, 3,
+	/* 3 */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 2, 1, 0, 3, 2, 1, 0, 3,
+	/* 4 */ 3, 0, 4, 8, 10, 12, 14, 14, 14, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 2, 1, 2, 1,
+	/* 5 */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 0, 1, 0, 3, 2, 1, 0, 3,
+	/* 6 */ 3, 0, 2, 4, 6, 10, 12, 12, 12, 0, 3, 0, 1, 0, 3, 0, 1, 2, 1, 0, 3,
+	/* 7 */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 2, 1, 2, 1, 2, 1, 2, 1,
+	/* 8 */ 3, 0, 2, 6, 8, 12, 14, 14, 14, 0, 3, 0, 1, 2, 1, 0, 3, 0, 1, 2, 1, 0, 3,
+	/* 9 */ 3, 0, 2, 6, 8, 10, 12, 12, 12, 0, 3, 0, 1, 2, 1, 0, 3, 2, 1, 0, 3,
+	/* : */ 1, 0, 0, 2, 2, 2, 4, 4, 4, 0, 1, 0, 1,
+	/* ; */ 1, 0, 0, 2, 2, 2, 4, 6, 6, 0, 1, 0, 1, 0, 1,
+	/* < */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 2, 1, 1, 1, 0, 1, 1, 1, 2, 1,
+	/* = */ 3, 0, 0, 2, 2, 4, 4, 4, 4, 0, 3, 0, 3,
+	/* > */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 1, 1, 2, 1, 1, 1, 0, 1,
+	/* ? */ 3, 0, 2, 4, 6, 6, 8, 8, 8, 0, 3, 2, 1, 1, 1, 1, 1,
+	/* @ */ 4, 0, 2, 6, 10, 14, 16, 18, 18, 0, 4, 0, 1, 3, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 0, 4,
+	/* A */ 3, 0, 2, 6, 10, 12, 16, 16, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 0, 1, 2, 1,
+	/* B */ 3, 0, 2, 6, 8, 12, 14, 14, 14, 0, 2, 0, 1, 2, 1, 0, 2, 0, 1, 2, 1, 0, 2,
+	/* C */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 0, 1, 0, 1, 0, 1, 0, 3,
+	/* D */ 3, 0, 2, 6, 10, 14, 16, 16, 16, 0, 2, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 2,
+	/* E */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 0, 1, 0, 3, 0, 1, 0, 3,
+	/* F */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 0, 1, 0, 3, 0, 1, 0, 1,
+	/* G */ 3, 0, 2, 4, 6, 10, 12, 12, 12, 0, 3, 0, 1, 0, 1, 0, 1, 2, 1, 0, 3,
+	/* H */ 3, 0, 4, 8, 10, 14, 18, 18, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* I */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* J */ 3, 0, 2, 4, 6, 10, 12, 12, 12, 2, 1, 2, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* K */ 3, 0, 4, 8, 10, 14, 18, 18, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 2, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* L */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3,
+	/* M */ 5, 0, 4, 8, 14, 18, 22, 22, 22, 0, 1, 4, 1, 0, 2, 3, 2, 0, 1, 2, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* N */ 4, 0, 4, 8, 10, 14, 18, 18, 18, 0, 1, 3, 1, 0, 2, 3, 1, 0, 4, 0, 1, 2, 2, 0, 1, 3, 1,
+	/* O */ 3, 0, 2, 6, 10, 14, 16, 16, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* P */ 3, 0, 2, 6, 8, 10, 12, 12, 12, 0, 3, 0, 1, 2, 1, 0, 3, 0, 1, 0, 1,
+	/* Q */ 3, 0, 2, 6, 10, 12, 14, 16, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 0, 3, 2, 1,
+	/* R */ 3, 0, 2, 6, 8, 12, 16, 16, 16, 0, 3, 0, 1, 2, 1, 0, 2, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* S */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 0, 1, 1, 1, 2, 1, 0, 3,
+	/* T */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* U */ 3, 0, 4, 8, 12, 16, 18, 18, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* V */ 3, 0, 4, 8, 12, 16, 18, 18, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 1, 1,
+	/* W */ 5, 0, 4, 8, 14, 18, 22, 22, 22, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 2, 3, 2, 0, 1, 4, 1,
+	/* X */ 3, 0, 4, 8, 10, 14, 18, 18, 18, 0, 1, 2, 1, 0, 1, 2, 1, 1, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* Y */ 3, 0, 4, 8, 10, 12, 14, 14, 14, 0, 1, 2, 1, 0, 1, 2, 1, 1, 1, 1, 1, 1, 1,
+	/* Z */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 2, 1, 1, 1, 0, 1, 0, 3,
+	/* [ */ 2, 0, 2, 4, 6, 8, 10, 10, 10, 0, 2, 0, 1, 0, 1, 0, 1, 0, 2,
+	/* \ */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 0, 1, 0, 1, 1, 1, 1, 1, 2, 1, 2, 1,
+	/* ] */ 2, 0, 2, 4, 6, 8, 10, 10, 10, 0, 2, 1, 1, 1, 1, 1, 1, 0, 2,
+	/* ^ */ 3, 0, 2, 6, 6, 6, 6, 6, 6, 1, 1, 0, 1, 2, 1,
+	/* _ */ 3, 0, 0, 0, 0, 0, 0, 2, 2, 0, 3,
+	/* ` */ 3, 0, 2, 4, 6, 6, 6, 6, 6, 0, 1, 1, 1, 2, 1,
+	/* a */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 2, 1, 0, 3, 0, 3,
+	/* b */ 3, 0, 2, 4, 8, 12, 14, 14, 14, 0, 1, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* c */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 0, 1, 0, 1, 0, 3,
+	/* d */ 3, 0, 2, 4, 8, 12, 14, 14, 14, 2, 1, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* e */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 0, 3, 0, 1, 0, 3,
+	/* f */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 1, 2, 1, 1, 0, 3, 1, 1, 1, 1,
+	/* g */ 3, 0, 0, 2, 6, 10, 12, 14, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 2, 1, 0, 3,
+	/* h */ 3, 0, 2, 4, 8, 12, 16, 16, 16, 0, 1, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* i */ 1, 0, 2, 2, 4, 6, 8, 8, 8, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* j */ 2, 0, 2, 2, 4, 6, 8, 10, 12, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2,
+	/* k */ 3, 0, 2, 6, 8, 10, 14, 14, 14, 0, 1, 0, 1, 2, 1, 0, 2, 0, 2, 0, 1, 2, 1,
+	/* l */ 2, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2,
+	/* m */ 5, 0, 0, 2, 8, 14, 20, 20, 20, 0, 5, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1,
+	/* n */ 3, 0, 0, 2, 6, 10, 14, 14, 14, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* o */ 3, 0, 0, 2, 6, 10, 12, 12, 12, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* p */ 3, 0, 0, 2, 6, 10, 12, 14, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 0, 1, 0, 1,
+	/* q */ 3, 0, 0, 2, 6, 10, 12, 14, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 2, 1, 2, 1,
+	/* r */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 0, 1, 0, 1, 0, 1,
+	/* s */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 0, 1, 2, 1, 0, 3,
+	/* t */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 1, 1, 0, 3, 1, 1, 1, 1, 1, 2,
+	/* u */ 3, 0, 0, 4, 8, 12, 14, 14, 14, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* v */ 3, 0, 0, 4, 8, 12, 14, 14, 14, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 1, 1,
+	/* w */ 5, 0, 0, 6, 12, 18, 20, 20, 20, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 5,
+	/* x */ 3, 0, 0, 4, 6, 8, 12, 12, 12, 0, 1, 2, 1, 1, 1, 1, 1, 0, 1, 2, 1,
+	/* y */ 3, 0, 0, 4, 8, 12, 14, 16, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 2, 1, 0, 3,
+	/* z */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 2, 1, 0, 1, 0, 3,
+	/* { */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 1, 2, 1, 1, 0, 2, 1, 1, 1, 2,
+	/* | */ 1, 0, 2, 4, 6, 8, 10, 12, 12, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* } */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 2, 1, 1, 1, 2, 1, 1, 0, 2,
+	/* ~ */ 4, 0, 0, 0, 2, 4, 4, 4, 4, 0, 2, 2, 2,
+};
+
+uint16_t const font_7_spans_index[] = {
+	/*   */ 1,
+	/* ! */ 10,
+	/* " */ 27,
+	/* # */ 44,
+	/* $ */ 69,
+	/* % */ 90,
+	/* & */ 113,
+	/* ' */ 136,
+	/* ( */ 149,
+	/* ) */ 168,
+	/* * */ 187,
+	/* + */ 200,
+	/* , */ 215,
+	/* - */ 228,
+	/* . */ 239,
+	/* / */ 250,
+	/* 0 */ 271,
+	/* 1 */ 296,
+	/* 2 */ 315,
+	/* 3 */ 334,
+	/* 4 */ 353,
+	/* 5 */ 376,
+	/* 6 */ 395,
+	/* 7 */ 416,
+	/* 8 */ 435,
+	/* 9 */ 458,
+	/* : */ 479,
+	/* ; */ 492,
+	/* < */ 507,
+	/* = */ 526,
+	/* > */ 539,
+	/* ? */ 558,
+	/* @ */ 575,
+	/* A */ 602,
+	/* B */ 627,
+	/* C */ 650,
+	/* D */ 669,
+	/* E */ 694,
+	/* F */ 713,
+	/* G */ 732,
+	/* H */ 753,
+	/* I */ 780,
+	/* J */ 799,
+	/* K */ 820,
+	/* L */ 847,
+	/* M */ 866,
+	/* N */ 897,
+	/* O */ 924,
+	/* P */ 949,
+	/* Q */ 970,
+	/* R */ 995,
+	/* S */ 1020,
+	/* T */ 1039,
+	/* U */ 1058,
+	/* V */ 1085,
+	/* W */ 1112,
+	/* X */ 1143,
+	/* Y */ 1170,
+	/* Z */ 1193,
+	/* [ */ 1212,
+	/* \ */ 1231,
+	/* ] */ 1252,
+	/* ^ */ 1271,
+	/* _ */ 1286,
+	/* ` */ 1297,
+	/* a */ 1312,
+	/* b */ 1329,
+	/* c */ 1352,
+	/* d */ 1369,
+	/* e */ 1392,
+	/* f */ 1409,
+	/* g */ 1428,
+	/* h */ 1453,
+	/* i */ 1478,
+	/* j */ 1495,
+	/* k */ 1516,
+	/* l */ 1539,
+	/* m */ 1558,
+	/* n */ 1587,
+	/* o */ 1610,
+	/* p */ 1631,
+	/* q */ 1656,
+	/* r */ 1681,
+	/* s */ 1698,
+	/* t */ 1715,
+	/* u */ 1734,
+	/* v */ 1757,
+	/* w */ 1780,
+	/* x */ 1809,
+	/* y */ 1830,
+	/* z */ 1857,
+	/* { */ 1874,
+	/* | */ 1893,
+	/* } */ 1914,
+	/* ~ */ 1933,
 };
 
-uint8_t const font_8[] = {
+uint8_t const font_8_spans[] = {
 
 	/* height */ 8,
 
-	/*   */ 1, 0x00,
-	/* ! */ 1, 0x2F,
-	/* " */ 3, 0x6D, 0x01, 0x00,
-	/* # */ 5, 0x40, 0x7D, 0xF5, 0x15, 0x00,
-	/* $ */ 5, 0xC4, 0x17, 0x47, 0x1F, 0x01,
-	/* % */ 4, 0x00, 0x49, 0x92, 0x00,
-	/* & */ 4, 0x52, 0xD2, 0xE5, 0x00,
-	/* ' */ 1, 0x07,
-	/* ( */ 2, 0x56, 0x25,
-	/* ) */ 2, 0xA9, 0x1A,
-	/* * */ 5, 0x80, 0x54, 0x57, 0x09, 0x00,
-	/* + */ 5, 0x80, 0x90, 0x4F, 0x08, 0x00,
-	/* , */ 2, 0x00, 0x18,
-	/* - */ 4, 0x00, 0xF0, 0x00, 0x00,
-	/* . */ 1, 0x20,
-	/* / */ 3, 0xA4, 0x94, 0x00,
-	/* 0 */ 4, 0x96, 0xBD, 0x69, 0x00,
-	/* 1 */ 3, 0x9A, 0xA4, 0x03,
-	/* 2 */ 4, 0x96, 0x48, 0xF2, 0x00,
-	/* 3 */ 4, 0x87, 0x8E, 0x78, 0x00,
-	/* 4 */ 4, 0xAC, 0xF9, 0x88, 0x00,
-	/* 5 */ 4, 0x1F, 0x87, 0x78, 0x00,
-	/* 6 */ 4, 0x16, 0x97, 0x69, 0x00,
-	/* 7 */ 4, 0x8F, 0x44, 0x22, 0x00,
-	/* 8 */ 4, 0x96, 0x96, 0x69, 0x00,
-	/* 9 */ 4, 0x96, 0xE9, 0x68, 0x00,
-	/* : */ 1, 0x24,
-	/* ; */ 2, 0x20, 0x18,
-	/* < */ 3, 0xA0, 0x22, 0x02,
-	/* = */ 4, 0x00, 0x0F, 0x0F, 0x00,
-	/* > */ 3, 0x88, 0xA8, 0x00,
-	/* ? */ 3, 0x2A, 0x05, 0x01,
-	/* @ */ 5, 0xC0, 0xC5, 0xDE, 0x83, 0x03,
-	/* A */ 4, 0x96, 0xF9, 0x99, 0x00,
-	/* B */ 4, 0x97, 0x97, 0x79, 0x00,
-	/* C */ 4, 0x1E, 0x11, 0xE1, 0x00,
-	/* D */ 4, 0x97, 0x99, 0x79, 0x00,
-	/* E */ 4, 0x1F, 0x17, 0xF1, 0x00,
-	/* F */ 4, 0x1F, 0x71, 0x11, 0x00,
-	/* G */ 4, 0x1E, 0xD1, 0xE9, 0x00,
-	/* H */ 4, 0x99, 0xF9, 0x99, 0x00,
-	/* I */ 3, 0x97, 0xA4, 0x03,
-	/* J */ 4, 0x4E, 0x44, 0x34, 0x00,
-	/* K */ 4, 0x59, 0x33, 0x95, 0x00,
-	/* L */ 4, 0x11, 0x11, 0xF1, 0x00,
-	/* M */ 5, 0x71, 0xD7, 0x18, 0x23, 0x00,
-	/* N */ 4, 0xB9, 0xDB, 0x9D, 0x00,
-	/* O */ 4, 0x96, 0x99, 0x69, 0x00,
-	/* P */ 4, 0x97, 0x79, 0x11, 0x00,
-	/* Q */ 4, 0x96, 0x99, 0xED, 0x00,
-	/* R */ 4, 0x97, 0x79, 0x95, 0x00,
-	/* S */ 4, 0x1E, 0x42, 0x78, 0x00,
-	/* T */ 5, 0x9F, 0x10, 0x42, 0x08, 0x00,
-	/* U */ 4, 0x99, 0x99, 0x69, 0x00,
-	/* V */ 5, 0x31, 0x46, 0xA5, 0x08, 0x00,
-	/* W */ 5, 0x31, 0xC6, 0x5A, 0x15, 0x00,
-	/* X */ 4, 0x99, 0x66, 0x99, 0x00,
-	/* Y */ 4, 0x99, 0x69, 0x12, 0x00,
-	/* Z */ 4, 0x8F, 0x24, 0xF1, 0x00,
-	/* [ */ 2, 0x57, 0x0D,
-	/* \ */ 3, 0x89, 0x44, 0x02,
-	/* ] */ 2, 0xAB, 0x0E,
-	/* ^ */ 3, 0x2A, 0x00, 0x00,
-	/* _ */ 3, 0x00, 0x80, 0x03,
-	/* ` */ 2, 0x09, 0x00,
-	/* a */ 4, 0x00, 0x9E, 0xE9, 0x00,
-	/* b */ 4, 0x11, 0x97, 0x79, 0x00,
-	/* c */ 4, 0x00, 0x1E, 0xE1, 0x00,
-	/* d */ 4, 0x88, 0x9E, 0xE9, 0x00,
-	/* e */ 4, 0x00, 0xF6, 0x61, 0x00,
-	/* f */ 3, 0x4E, 0x96, 0x00,
-	/* g */ 4, 0x00, 0x9E, 0xE9, 0x68,
-	/* h */ 4, 0x11, 0x97, 0x99, 0x00,
-	/* i */ 3, 0xC2, 0x24, 0x03,
-	/* j */ 3, 0xC2, 0x24, 0x29,
-	/* k */ 4, 0x11, 0x59, 0x97, 0x00,
-	/* l */ 3, 0x93, 0xA4, 0x03,
-	/* m */ 5, 0x00, 0xBC, 0x5A, 0x2B, 0x00,
-	/* n */ 4, 0x00, 0x97, 0x99, 0x00,
-	/* o */ 4, 0x00, 0x96, 0x69, 0x00,
-	/* p */ 4, 0x00, 0x97, 0x79, 0x11,
-	/* q */ 4, 0x00, 0x9E, 0xE9, 0x88,
-	/* r */ 4, 0x00, 0x3D, 0x11, 0x00,
-	/* s */ 4, 0x00, 0x3E, 0x7C, 0x00,
-	/* t */ 3, 0xC9, 0x13, 0x03,
-	/* u */ 4, 0x00, 0x99, 0xE9, 0x00,
-	/* v */ 5, 0x00, 0xC4, 0xA8, 0x08, 0x00,
-	/* w */ 5, 0x00, 0xC4, 0x5A, 0x15, 0x00,
-	/* x */ 4, 0x00, 0x69, 0x96, 0x00,
-	/* y */ 4, 0x00, 0x99, 0xE9, 0x68,
-	/* z */ 4, 0x00, 0x4F, 0xF2, 0x00,
-	/* { */ 3, 0xD6, 0x26, 0x03,
-	/* | */ 1, 0x3E,
-	/* } */ 3, 0x93, 0xAD, 0x01,
-	/* ~ */ 5, 0x40, 0x54, 0x04, 0x00, 0x00,
+	/*   */ 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ! */ 1, 0, 2, 4, 6, 8, 8, 10, 10, 10, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* " */ 3, 0, 4, 8, 12, 12, 12, 12, 12, 12, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* # */ 5, 0, 0, 4, 6, 10, 12, 16, 16, 16, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1,
+	/* $ */ 5, 0, 2, 4, 8, 10, 14, 16, 18, 18, 2, 1, 1, 4, 0, 1, 2, 1, 1, 3, 2, 1, 4, 1, 0, 4, 2, 1,
+	/* % */ 4, 0, 0, 0, 4, 6, 8, 12, 12, 12, 0, 1, 3, 1, 2, 1, 1, 1, 0, 1, 3, 1,
+	/* & */ 4, 0, 2, 6, 8, 12, 16, 18, 18, 18, 1, 1, 0, 1, 2, 1, 1, 1, 0, 1, 2, 2, 0, 1, 2, 1, 1, 3,
+	/* ' */ 1, 0, 2, 4, 6, 6, 6, 6, 6, 6, 0, 1, 0, 1, 0, 1,
+	/* ( */ 2, 0, 2, 4, 6, 8, 10, 12, 14, 14, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1,
+	/* ) */ 2, 0, 2, 4, 6, 8, 10, 12, 14, 14, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+	/* * */ 5, 0, 0, 2, 8, 10, 16, 18, 18, 18, 2, 1, 0, 1, 2, 1, 4, 1, 1, 3, 0, 1, 2, 1, 4, 1, 2, 1,
+	/* + */ 5, 0, 0, 2, 4, 6, 8, 10, 10, 10, 2, 1, 2, 1, 0, 5, 2, 1, 2, 1,
+	/* , */ 2, 0, 0, 0, 0, 0, 0, 2, 4, 4, 1, 1, 0, 1,
+	/* - */ 4, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 4,
+	/* . */ 1, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 1,
+	/* / */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 2, 1, 2, 1, 1, 1, 1, 1, 0, 1, 0, 1,
+	/* 0 */ 4, 0, 2, 6, 10, 14, 18, 20, 20, 20, 1, 2, 0, 1, 3, 1, 0, 1, 2, 2, 0, 2, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* 1 */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 1, 0, 2, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* 2 */ 4, 0, 2, 6, 8, 10, 12, 14, 14, 14, 1, 2, 0, 1, 3, 1, 3, 1, 2, 1, 1, 1, 0, 4,
+	/* 3 */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 3, 3, 1, 1, 3, 3, 1, 3, 1, 0, 3,
+	/* 4 */ 4, 0, 2, 6, 10, 12, 14, 16, 16, 16, 2, 2, 1, 1, 3, 1, 0, 1, 3, 1, 0, 4, 3, 1, 3, 1,
+	/* 5 */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 4, 0, 1, 0, 3, 3, 1, 3, 1, 0, 3,
+	/* 6 */ 4, 0, 2, 4, 6, 10, 14, 16, 16, 16, 1, 2, 0, 1, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* 7 */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 4, 3, 1, 2, 1, 2, 1, 1, 1, 1, 1,
+	/* 8 */ 4, 0, 2, 6, 8, 12, 16, 18, 18, 18, 1, 2, 0, 1, 3, 1, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* 9 */ 4, 0, 2, 6, 10, 12, 14, 16, 16, 16, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3, 3, 1, 1, 2,
+	/* : */ 1, 0, 0, 0, 2, 2, 2, 4, 4, 4, 0, 1, 0, 1,
+	/* ; */ 2, 0, 0, 0, 2, 2, 2, 4, 6, 6, 1, 1, 1, 1, 0, 1,
+	/* < */ 3, 0, 0, 2, 4, 6, 8, 10, 10, 10, 2, 1, 1, 1, 0, 1, 1, 1, 2, 1,
+	/* = */ 4, 0, 0, 0, 2, 2, 4, 4, 4, 4, 0, 4, 0, 4,
+	/* > */ 3, 0, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 1, 1, 2, 1, 1, 1, 0, 1,
+	/* ? */ 3, 0, 2, 6, 8, 10, 10, 12, 12, 12, 1, 1, 0, 1, 2, 1, 2, 1, 1, 1, 1, 1,
+	/* @ */ 5, 0, 0, 2, 6, 10, 14, 16, 18, 18, 1, 3, 0, 1, 4, 1, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 1, 3,
+	/* A */ 4, 0, 2, 6, 10, 12, 16, 20, 20, 20, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 0, 4, 0, 1, 3, 1, 0, 1, 3, 1,
+	/* B */ 4, 0, 2, 6, 8, 12, 16, 18, 18, 18, 0, 3, 0, 1, 3, 1, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3,
+	/* C */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 3, 0, 1, 0, 1, 0, 1, 0, 1, 1, 3,
+	/* D */ 4, 0, 2, 6, 10, 14, 18, 20, 20, 20, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3,
+	/* E */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 4, 0, 1, 0, 3, 0, 1, 0, 1, 0, 4,
+	/* F */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 4, 0, 1, 0, 1, 0, 3, 0, 1, 0, 1,
+	/* G */ 4, 0, 2, 4, 6, 10, 14, 16, 16, 16, 1, 3, 0, 1, 0, 1, 0, 1, 2, 2, 0, 1, 3, 1, 1, 3,
+	/* H */ 4, 0, 4, 8, 12, 14, 18, 22, 22, 22, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 4, 0, 1, 3, 1, 0, 1, 3, 1,
+	/* I */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* J */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 3, 2, 1, 2, 1, 2, 1, 2, 1, 0, 2,
+	/* K */ 4, 0, 4, 8, 10, 12, 16, 20, 20, 20, 0, 1, 3, 1, 0, 1, 2, 1, 0, 2, 0, 2, 0, 1, 2, 1, 0, 1, 3, 1,
+	/* L */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 4,
+	/* M */ 5, 0, 4, 8, 14, 18, 22, 26, 26, 26, 0, 1, 4, 1, 0, 2, 3, 2, 0, 1, 2, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* N */ 4, 0, 4, 8, 12, 16, 20, 24, 24, 24, 0, 1, 3, 1, 0, 2, 3, 1, 0, 2, 3, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 3, 1,
+	/* O */ 4, 0, 2, 6, 10, 14, 18, 20, 20, 20, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* P */ 4, 0, 2, 6, 10, 12, 14, 16, 16, 16, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3, 0, 1, 0, 1,
+	/* Q */ 4, 0, 2, 6, 10, 14, 18, 20, 20, 20, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 2, 2, 1, 3,
+	/* R */ 4, 0, 2, 6, 10, 12, 16, 20, 20, 20, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3, 0, 1, 2, 1, 0, 1, 3, 1,
+	/* S */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 3, 0, 1, 1, 1, 2, 1, 3, 1, 0, 3,
+	/* T */ 5, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 5, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+	/* U */ 4, 0, 4, 8, 12, 16, 20, 22, 22, 22, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* V */ 5, 0, 4, 8, 12, 16, 20, 22, 22, 22, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1,
+	/* W */ 5, 0, 4, 8, 12, 18, 24, 28, 28, 28, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 1, 1, 3, 1,
+	/* X */ 4, 0, 4, 8, 10, 12, 16, 20, 20, 20, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1,
+	/* Y */ 4, 0, 4, 8, 12, 14, 16, 18, 18, 18, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2, 1, 1, 0, 1,
+	/* Z */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 4, 3, 1, 2, 1, 1, 1, 0, 1, 0, 4,
+	/* [ */ 2, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2,
+	/* \ */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 1, 0, 1, 1, 1, 1, 1, 2, 1, 2, 1,
+	/* ] */ 2, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2,
+	/* ^ */ 3, 0, 2, 6, 6, 6, 6, 6, 6, 6, 1, 1, 0, 1, 2, 1,
+	/* _ */ 3, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 3,
+	/* ` */ 2, 0, 2, 4, 4, 4, 4, 4, 4, 4, 0, 1, 1, 1,
+	/* a */ 4, 0, 0, 0, 2, 6, 10, 12, 12, 12, 1, 3, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3,
+	/* b */ 4, 0, 2, 4, 6, 10, 14, 16, 16, 16, 0, 1, 0, 1, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3,
+	/* c */ 4, 0, 0, 0, 2, 4, 6, 8, 8, 8, 1, 3, 0, 1, 0, 1, 1, 3,
+	/* d */ 4, 0, 2, 4, 6, 10, 14, 16, 16, 16, 3, 1, 3, 1, 1, 3, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3,
+	/* e */ 4, 0, 0, 0, 2, 4, 6, 8, 8, 8, 1, 2, 0, 4, 0, 1, 1, 2,
+	/* f */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 2, 0, 1, 0, 1, 0, 2, 0, 1, 0, 1,
+	/* g */ 4, 0, 0, 0, 2, 6, 10, 12, 14, 16, 1, 3, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3, 3, 1, 1, 2,
+	/* h */ 4, 0, 2, 4, 6, 10, 14, 18, 18, 18, 0, 1, 0, 1, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1,
+	/* i */ 3, 0, 2, 2, 4, 6, 8, 10, 10, 10, 1, 1, 0, 2, 1, 1, 1, 1, 1, 2,
+	/* j */ 3, 0, 2, 2, 4, 6, 8, 10, 12, 14, 1, 1, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+	/* k */ 4, 0, 2, 4, 8, 12, 14, 18, 18, 18, 0, 1, 0, 1, 0, 1, 3, 1, 0, 1, 2, 1, 0, 3, 0, 1, 3, 1,
+	/* l */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* m */ 5, 0, 0, 0, 2, 8, 14, 20, 20, 20, 0, 4, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1,
+	/* n */ 4, 0, 0, 0, 2, 6, 10, 14, 14, 14, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1,
+	/* o */ 4, 0, 0, 0, 2, 6, 10, 12, 12, 12, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* p */ 4, 0, 0, 0, 2, 6, 10, 12, 14, 16, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3, 0, 1, 0, 1,
+	/* q */ 4, 0, 0, 0, 2, 6, 10, 12, 14, 16, 1, 3, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3, 3, 1, 3, 1,
+	/* r */ 4, 0, 0, 0, 4, 6, 8, 10, 10, 10, 0, 1, 2, 2, 0, 2, 0, 1, 0, 1,
+	/* s */ 4, 0, 0, 0, 2, 4, 6, 8, 8, 8, 1, 3, 0, 2, 2, 2, 0, 3,
+	/* t */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 1, 0, 1, 0, 3, 0, 1, 0, 1, 1, 2,
+	/* u */ 4, 0, 0, 0, 4, 8, 12, 14, 14, 14, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3,
+	/* v */ 5, 0, 0, 0, 4, 8, 12, 14, 14, 14, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 2, 1,
+	/* w */ 5, 0, 0, 0, 4, 10, 16, 20, 20, 20, 0, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 1, 1, 3, 1,
+	/* x */ 4, 0, 0, 0, 4, 6, 8, 12, 12, 12, 0, 1, 3, 1, 1, 2, 1, 2, 0, 1, 3, 1,
+	/* y */ 4, 0, 0, 0, 4, 8, 12, 14, 16, 18, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3, 3, 1, 1, 2,
+	/* z */ 4, 0, 0, 0, 2, 4, 6, 8, 8, 8, 0, 4, 2, 1, 1, 1, 0, 4,
+	/* { */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 2, 1, 1, 0, 2, 0, 2, 1, 1, 1, 2,
+	/* | */ 1, 0, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* } */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 2, 1, 1, 1, 2, 1, 2, 1, 1, 0, 2,
+	/* ~ */ 5, 0, 0, 2, 8, 10, 10, 10, 10, 10, 1, 1, 0, 1, 2, 1, 4, 1, 3, 1,
+};
+
+uint16_t const font_8_spans_index[] = {
+	/*   */ 1,
+	/* ! */ 11,
+	/* " */ 31,
+	/* # */ 53,
+	/* $ */ 79,
+	/* % */ 107,
+	/* & */ 129,
+	/* ' */ 157,
+	/* ( */ 173,
+	/* ) */ 197,
+	/* * */ 221,
+	/* + */ 249,
+	/* , */ 269,
+	/* - */ 283,
+	/* . */ 295,
+	/* / */ 307,
+	/* 0 */ 329,
+	/* 1 */ 359,
+	/* 2 */ 381,
+	/* 3 */ 405,
+	/* 4 */ 427,
+	/* 5 */ 453,
+	/* 6 */ 475,
+	/* 7 */ 501,
+	/* 8 */ 523,
+	/* 9 */ 551,
+	/* : */ 577,
+	/* ; */ 591,
+	/* < */ 607,
+	/* = */ 627,
+	/* > */ 641,
+	/* ? */ 661,
+	/* @ */ 683,
+	/* A */ 711,
+	/* B */ 741,
+	/* C */ 769,
+	/* D */ 791,
+	/* E */ 821,
+	/* F */ 843,
+	/* G */ 865,
+	/* H */ 891,
+	/* I */ 923,
+	/* J */ 945,
+	/* K */ 967,
+	/* L */ 997,
+	/* M */ 1019,
+	/* N */ 1055,
+	/* O */ 1089,
+	/* P */ 1119,
+	/* Q */ 1145,
+	/* R */ 1175,
+	/* S */ 1205,
+	/* T */ 1227,
+	/* U */ 1249,
+	/* V */ 1281,
+	/* W */ 1313,
+	/* X */ 1351,
+	/* Y */ 1381,
+	/* Z */ 1409,
+	/* [ */ 1431,
+	/* \ */ 1453,
+	/* ] */ 1475,
+	/* ^ */ 1497,
+	/* _ */ 1513,
+	/* ` */ 1525,
+	/* a */ 1539,
+	/* b */ 1561,
+	/* c */ 1587,
+	/* d */ 1605,
+	/* e */ 1631,
+	/* f */ 1649,
+	/* g */ 1671,
+	/* h */ 1697,
+	/* i */ 1725,
+	/* j */ 1745,
+	/* k */ 1769,
+	/* l */ 1797,
+	/* m */ 1819,
+	/* n */ 1849,
+	/* o */ 1873,
+	/* p */ 1895,
+	/* q */ 1921,
+	/* r */ 1947,
+	/* s */ 1967,
+	/* t */ 1985,
+	/* u */ 2007,
+	/* v */ 2031,
+	/* w */ 2055,
+	/* x */ 2085,
+	/* y */ 2107,
+	/* z */ 2135,
+	/* { */ 2153,
+	/* | */ 2175,
+	/* } */ 2195,
+	/* ~ */ 2217,
 };
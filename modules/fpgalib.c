@@ -102,3 +102,13 @@ uint8_t fpga_graphics_dev() {
 void fpga_write_internal(uint8_t *buf, unsigned int len, bool hold) {
   spi_write(FPGA, buf, len, hold);
 }
+
+// Stream buf out on EasyDMA while the caller carries on; buf must stay
+// untouched until fpga_write_busy() returns false.
+void fpga_write_background(uint8_t *buf, unsigned int len) {
+  spi_write_background(FPGA, buf, len);
+}
+
+bool fpga_write_busy() {
+  return spi_stream_busy();
+}
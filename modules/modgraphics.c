@@ -22,8 +22,11 @@ limitations under the License.
 #endif
 
 #include "py/runtime.h"
+#include "py/mperrno.h"
+#include "py/stream.h"
 
 #include "vgr2dlib.h"
+#include "vgr2dcmd.h"
 
 #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
 #define MFREE(ptr, sz) m_free(ptr, sz)
@@ -31,19 +34,41 @@ limitations under the License.
 #define MFREE(ptr, sz) m_free(ptr)
 #endif
 
-#define MAX_RUNS 128
-
-#define MAX_DX 0x7fff // 9.4
-#define MAX_NLX 0x7fff // 9.4
-#define MAX_SPANX 0x7fff // 9.4
-#define MAX_CLRX 0xff // 4.4
-#define MIN_DX 0x10
-
 extern uint8_t fpga_graphics_dev();
 extern void fpga_write_internal(uint8_t *buf, unsigned int len, bool hold);
+extern void fpga_write_background(uint8_t *buf, unsigned int len);
+extern bool fpga_write_busy();
+extern uint8_t const font_50_spans[]; // display.c, from font.h
+extern uint16_t const font_50_spans_index[];
+
+
+#ifndef VGR2D_ARENA_SIZE
+#define VGR2D_ARENA_SIZE 4096
+#endif
+
+MP_REGISTER_ROOT_POINTER(uint8_t *rvgr_arena);
 
+static vgr2d_arena_t arena;
+
+// Reset the arena at the start and end of every generate, allocating its
+// memory on first use.
+static void arena_reset(void) {
+  if (MP_STATE_VM(rvgr_arena) == NULL) {
+    MP_STATE_VM(rvgr_arena) = m_new(uint8_t, VGR2D_ARENA_SIZE);
+    vgr2d_arena_init(&arena, MP_STATE_VM(rvgr_arena), VGR2D_ARENA_SIZE);
+  }
+  vgr2d_arena_reset(&arena);
+}
 
 void *vgr2d_alloc(size_t size, int n) {
+  void *p = vgr2d_arena_alloc(&arena, size * n);
+  if (p == NULL)
+    p = m_malloc(size * n); // spilled, left for the GC
+  return p;
+}
+
+// Per-shape tables, kept for the life of the shape
+void *vgr2d_shape_alloc(size_t size, int n) {
   return m_malloc(size * n);
 }
 
@@ -51,6 +76,7 @@ void *vgr2d_alloc(size_t size, int n) {
 //////////////////////////////////////// Shared
 
 static transform_t *get_transform(mp_obj_t obj);
+static void check_linear(mp_obj_t obj, int deg, int32_t sx, int32_t sy);
 
 static void transform_print(const mp_print_t *print, transform_t *tr) {
   mp_printf(print, "(%d,%d)", (int)(tr->tx/XSCALE), (int)(tr->ty/YSCALE));
@@ -63,12 +89,61 @@ static mp_obj_t set_position(mp_obj_t obj, mp_obj_t x_obj, mp_obj_t y_obj) {
     int y = mp_obj_get_int(y_obj);
     tr->tx = XFX(x);
     tr->ty = YFX(y);
+    tr->rev++;
   }
   return obj;
 }
 
 static MP_DEFINE_CONST_FUN_OBJ_3(set_position_obj, set_position);
 
+// rotate(deg): clockwise in whole degrees about the pivot, replacing the
+// previous rotation. Ellipses and arcs keep their axes upright, so unless
+// they are circles they only turn by multiples of 90 degrees.
+static mp_obj_t set_rotation(mp_obj_t obj, mp_obj_t deg_obj) {
+  transform_t *tr = get_transform(obj);
+  if (tr != NULL) {
+    int deg = mp_obj_get_int(deg_obj);
+    check_linear(obj, deg, tr->sx, tr->sy);
+    transform_set_linear(tr, deg, tr->sx, tr->sy);
+  }
+  return obj;
+}
+
+static MP_DEFINE_CONST_FUN_OBJ_2(set_rotation_obj, set_rotation);
+
+static int32_t get_scale(mp_obj_t obj) {
+  mp_float_t f = mp_obj_get_float(obj);
+  if (!(f > 0 && f < 64))
+    mp_raise_ValueError(MP_ERROR_TEXT("Scale must be between 0 and 64"));
+  return (int32_t)(f * XFORM_ONE);
+}
+
+// scale(s[, sy]): about the pivot, replacing the previous scale. Stroke
+// widths are not scaled.
+static mp_obj_t set_scale(size_t n_args, const mp_obj_t *args) {
+  transform_t *tr = get_transform(args[0]);
+  if (tr != NULL) {
+    int32_t sx = get_scale(args[1]);
+    int32_t sy = (n_args > 2) ? get_scale(args[2]) : sx;
+    check_linear(args[0], tr->deg, sx, sy);
+    transform_set_linear(tr, tr->deg, sx, sy);
+  }
+  return args[0];
+}
+
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(set_scale_obj, 2, 3, set_scale);
+
+// pivot(x, y): the point, in the shape's own coordinates, that rotate()
+// and scale() keep in place, (0, 0) by default
+static mp_obj_t set_pivot(mp_obj_t obj, mp_obj_t x_obj, mp_obj_t y_obj) {
+  transform_t *tr = get_transform(obj);
+  if (tr != NULL)
+    transform_set_pivot(tr, XFX(mp_obj_get_int(x_obj)), YFX(mp_obj_get_int(y_obj)));
+  return obj;
+}
+
+static MP_DEFINE_CONST_FUN_OBJ_3(set_pivot_obj, set_pivot);
+
 
 //////////////////////////////////////// Rect
 
@@ -90,6 +165,7 @@ static mp_obj_t rect_make_new(const mp_obj_type_t *type, size_t n_args, size_t n
   self->rect.w = mp_obj_get_int(args[0]);
   self->rect.h = mp_obj_get_int(args[1]);
   self->rect.fclr = mp_obj_get_int(args[2]);
+  self->rect.outline.pts = NULL;
 
   return MP_OBJ_FROM_PTR(self);
 }
@@ -104,6 +180,9 @@ static void rect_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_
 
 static const mp_rom_map_elem_t rect_locals_dict_table[] = {
   { MP_ROM_QSTR(MP_QSTR_position), MP_ROM_PTR(&set_position_obj) },
+  { MP_ROM_QSTR(MP_QSTR_rotate), MP_ROM_PTR(&set_rotation_obj) },
+  { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&set_scale_obj) },
+  { MP_ROM_QSTR(MP_QSTR_pivot), MP_ROM_PTR(&set_pivot_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(rect_locals_dict, rect_locals_dict_table);
@@ -125,6 +204,81 @@ typedef struct polygon_obj_s {
   polygon_t poly;
 } polygon_obj_t;
 
+// Point i of the buffer or list, checked to be in range
+static void get_poly_point(const uint8_t *xy, mp_obj_t *list, size_t i, int *x, int *y) {
+  if (xy != NULL) {
+    // native byte order, any alignment
+    int16_t v[2];
+    memcpy(v, xy + 4*i, 4);
+    *x = v[0];
+    *y = v[1];
+  } else {
+    size_t tpl_len;
+    mp_obj_t *tpl;
+    mp_obj_get_array(list[i], &tpl_len, &tpl);
+    if (tpl_len != 2)
+      mp_raise_ValueError(MP_ERROR_TEXT("List element is not a pair"));
+    *x = mp_obj_get_int(tpl[0]);
+    *y = mp_obj_get_int(tpl[1]);
+  }
+  if (*x < 0 || *x >= 4096 || *y < 0 || *y >= 4096)
+    mp_raise_ValueError(MP_ERROR_TEXT("Point out of range 0..4095"));
+}
+
+// Points from a list or tuple of (x, y) pairs, or from any buffer of
+// interleaved int16 x, y such as array('h'), which is read in place with
+// no object per point. The point table is only reallocated when the
+// number of points changes. A closed outline repeats the first point.
+// All the points are checked before any is stored, so a failed call
+// leaves the shape as it was.
+static void set_poly_points(polygon_t *poly, mp_obj_t pts_in, bool closed) {
+  mp_buffer_info_t bufinfo;
+  const uint8_t *xy = NULL;
+  mp_obj_t *list = NULL;
+  size_t n, i;
+  int x, y, n_pts;
+
+  if (mp_get_buffer(pts_in, &bufinfo, MP_BUFFER_READ)) {
+    if (bufinfo.len % 4 != 0)
+      mp_raise_ValueError(MP_ERROR_TEXT("Buffer must hold int16 x, y pairs"));
+    xy = (const uint8_t *)bufinfo.buf;
+    n = bufinfo.len / 4;
+  } else
+    mp_obj_get_array(pts_in, &n, &list);
+  if (n < 2)
+    mp_raise_ValueError(MP_ERROR_TEXT("Need at least 2 points"));
+  for (i = 0; i < n; i++)
+    get_poly_point(xy, list, i, &x, &y);
+
+  n_pts = 2*n + (closed ? 2 : 0);
+  if (poly->pts == NULL || poly->n_pts != n_pts) {
+    poly->pts = (poly->pts == NULL) ? m_new(uint16_t, n_pts) : m_renew(uint16_t, poly->pts, poly->n_pts, n_pts);
+    // edge tables are sized from the point count, the old ones go to the GC
+    poly->edges = NULL;
+    poly->xpts = NULL;
+    poly->n_pts = n_pts;
+  }
+
+  for (i = 0; i < n; i++) {
+    get_poly_point(xy, list, i, &x, &y);
+    poly->pts[2*i] = XFX(x);
+    poly->pts[2*i+1] = YFX(y);
+  }
+  if (closed) {
+    poly->pts[2*n] = poly->pts[0];
+    poly->pts[2*n+1] = poly->pts[1];
+  }
+  polygon_build_edges(poly);
+  poly->tr.rev++;
+}
+
+// Stroke join keyword, one of MITER, BEVEL or ROUND
+static uint8_t get_join(mp_int_t join) {
+  if (join < JOIN_MITER || join > JOIN_ROUND)
+    mp_raise_ValueError(MP_ERROR_TEXT("Join must be MITER, BEVEL or ROUND"));
+  return (uint8_t)join;
+}
+
 static mp_obj_t polygon_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
   mp_arg_check_num(n_args, n_kw, 1, 1, true);
 
@@ -140,6 +294,7 @@ static mp_obj_t polygon_make_new(const mp_obj_type_t *type, size_t n_args, size_
     { MP_QSTR_fill, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
     { MP_QSTR_stroke, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
     { MP_QSTR_width, MP_ARG_INT, {.u_int = 3} },
+    { MP_QSTR_join, MP_ARG_INT, {.u_int = JOIN_MITER} },
   };
 
   mp_arg_val_t parsed_args[MP_ARRAY_SIZE(allowed_args)];
@@ -159,28 +314,10 @@ static mp_obj_t polygon_make_new(const mp_obj_type_t *type, size_t n_args, size_
   self->poly.width = parsed_args[2].u_int;
   if (self->poly.width < 1)
     mp_raise_ValueError(MP_ERROR_TEXT("Stoke width must be at least 1"));
+  self->poly.join = get_join(parsed_args[3].u_int);
 
-  size_t list_len = 0;
-  mp_obj_t *list = NULL;
-  mp_obj_list_get(args[0], &list_len, &list);
-
-  self->poly.n_pts = 2*list_len+2;
-  self->poly.pts = m_new(uint16_t, self->poly.n_pts);
-
-  int i, j;
-  for (i = 0, j = 0; i < list_len; i++, j+=2) {
-    size_t tpl_len;
-    mp_obj_t *tpl;
-    mp_obj_tuple_get(list[i], &tpl_len, &tpl);
-    if (tpl_len==2) {
-      self->poly.pts[j] = XFX(mp_obj_get_int(tpl[0]));
-      self->poly.pts[j+1] = YFX(mp_obj_get_int(tpl[1]));
-    } else {
-      mp_raise_ValueError(MP_ERROR_TEXT("List element is not a pair"));
-    }
-  }
-  self->poly.pts[j++] = self->poly.pts[0];
-  self->poly.pts[j++] = self->poly.pts[1];
+  self->poly.pts = NULL;
+  set_poly_points(&(self->poly), args[0], true);
 
   return MP_OBJ_FROM_PTR(self);
 }
@@ -205,8 +342,21 @@ static void polygon_print(const mp_print_t *print, mp_obj_t self_in, mp_print_ki
   transform_print(print, &(self->poly.tr));
 }
 
+// set_points(points): same forms as the constructor
+static mp_obj_t polygon_set_points(mp_obj_t self_in, mp_obj_t pts_in) {
+  polygon_obj_t *self = (polygon_obj_t *)MP_OBJ_TO_PTR(self_in);
+  set_poly_points(&(self->poly), pts_in, true);
+  return self_in;
+}
+
+static MP_DEFINE_CONST_FUN_OBJ_2(polygon_set_points_obj, polygon_set_points);
+
 static const mp_rom_map_elem_t polygon_locals_dict_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_set_points), MP_ROM_PTR(&polygon_set_points_obj) },
   { MP_ROM_QSTR(MP_QSTR_position), MP_ROM_PTR(&set_position_obj) },
+  { MP_ROM_QSTR(MP_QSTR_rotate), MP_ROM_PTR(&set_rotation_obj) },
+  { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&set_scale_obj) },
+  { MP_ROM_QSTR(MP_QSTR_pivot), MP_ROM_PTR(&set_pivot_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(polygon_locals_dict, polygon_locals_dict_table);
@@ -228,8 +378,9 @@ typedef struct polyline_obj_s {
   polygon_t poly;
 } polyline_obj_t;
 
+// Polyline(points, color[, width], join=MITER)
 static mp_obj_t polyline_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
-  mp_arg_check_num(n_args, n_kw, 2, 3, false);
+  mp_arg_check_num(n_args, n_kw, 2, 3, true);
 
   polyline_obj_t *self = m_new_obj(polyline_obj_t);
   self->base.type = (mp_obj_type_t *)type;
@@ -243,25 +394,19 @@ static mp_obj_t polyline_make_new(const mp_obj_type_t *type, size_t n_args, size
   if (self->poly.width < 1)
     mp_raise_ValueError(MP_ERROR_TEXT("Stoke width must be at least 1"));
 
-  size_t list_len = 0;
-  mp_obj_t *list = NULL;
-  mp_obj_list_get(args[0], &list_len, &list);
+  mp_map_t kwargs;
+  mp_map_init_fixed_table(&kwargs, n_kw, args + n_args);
 
-  self->poly.n_pts = 2*list_len;
-  self->poly.pts = m_new(uint16_t, self->poly.n_pts);
+  static const mp_arg_t allowed_args[] = {
+    { MP_QSTR_join, MP_ARG_INT, {.u_int = JOIN_MITER} },
+  };
 
-  int i, j;
-  for (i = 0, j = 0; i < list_len; i++, j+=2) {
-    size_t tpl_len;
-    mp_obj_t *tpl;
-    mp_obj_tuple_get(list[i], &tpl_len, &tpl);
-    if (tpl_len==2) {
-      self->poly.pts[j] = XFX(mp_obj_get_int(tpl[0]));
-      self->poly.pts[j+1] = YFX(mp_obj_get_int(tpl[1]));
-    } else {
-      mp_raise_ValueError(MP_ERROR_TEXT("List element is not a pair"));
-    }
-  }
+  mp_arg_val_t parsed_args[MP_ARRAY_SIZE(allowed_args)];
+  mp_arg_parse_all(0, args, &kwargs, MP_ARRAY_SIZE(allowed_args), allowed_args, parsed_args);
+  self->poly.join = get_join(parsed_args[0].u_int);
+
+  self->poly.pts = NULL;
+  set_poly_points(&(self->poly), args[0], false);
 
   return MP_OBJ_FROM_PTR(self);
 }
@@ -286,8 +431,20 @@ static void polyline_print(const mp_print_t *print, mp_obj_t self_in, mp_print_k
   transform_print(print, &(self->poly.tr));
 }
 
+static mp_obj_t polyline_set_points(mp_obj_t self_in, mp_obj_t pts_in) {
+  polyline_obj_t *self = (polyline_obj_t *)MP_OBJ_TO_PTR(self_in);
+  set_poly_points(&(self->poly), pts_in, false);
+  return self_in;
+}
+
+static MP_DEFINE_CONST_FUN_OBJ_2(polyline_set_points_obj, polyline_set_points);
+
 static const mp_rom_map_elem_t polyline_locals_dict_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_set_points), MP_ROM_PTR(&polyline_set_points_obj) },
   { MP_ROM_QSTR(MP_QSTR_position), MP_ROM_PTR(&set_position_obj) },
+  { MP_ROM_QSTR(MP_QSTR_rotate), MP_ROM_PTR(&set_rotation_obj) },
+  { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&set_scale_obj) },
+  { MP_ROM_QSTR(MP_QSTR_pivot), MP_ROM_PTR(&set_pivot_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(polyline_locals_dict, polyline_locals_dict_table);
@@ -324,6 +481,7 @@ static mp_obj_t line_make_new(const mp_obj_type_t *type, size_t n_args, size_t n
   if (self->poly.width < 1)
     mp_raise_ValueError(MP_ERROR_TEXT("Stoke width must be at least 1"));
 
+  self->poly.join = JOIN_MITER;
   self->poly.n_pts = 4;
   self->poly.pts = m_new(uint16_t, self->poly.n_pts);
 
@@ -332,7 +490,10 @@ static mp_obj_t line_make_new(const mp_obj_type_t *type, size_t n_args, size_t n
     self->poly.pts[j] = XFX(mp_obj_get_int(args[j]));
     self->poly.pts[j+1] = YFX(mp_obj_get_int(args[j+1]));
   }
-  
+  self->poly.edges = NULL;
+  self->poly.xpts = NULL;
+  polygon_build_edges(&(self->poly));
+
   return MP_OBJ_FROM_PTR(self);
 }
 
@@ -358,6 +519,9 @@ static void line_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_
 
 static const mp_rom_map_elem_t line_locals_dict_table[] = {
   { MP_ROM_QSTR(MP_QSTR_position), MP_ROM_PTR(&set_position_obj) },
+  { MP_ROM_QSTR(MP_QSTR_rotate), MP_ROM_PTR(&set_rotation_obj) },
+  { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&set_scale_obj) },
+  { MP_ROM_QSTR(MP_QSTR_pivot), MP_ROM_PTR(&set_pivot_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(line_locals_dict, line_locals_dict_table);
@@ -373,6 +537,306 @@ MP_DEFINE_CONST_OBJ_TYPE(
 
 
 
+//////////////////////////////////////// Ellipse
+
+typedef struct ellipse_obj_s {
+  mp_obj_base_t base;
+  ellipse_t ell;
+} ellipse_obj_t;
+
+// Ellipse and Arc take rx, ry and n_pos-2 more positional arguments, then
+// the same keywords as Polygon. The position is the center. When rx and
+// ry differ, rotate() only takes multiples of 90 degrees.
+static ellipse_obj_t *ellipse_new(const mp_obj_type_t *type, size_t n_pos, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+  mp_arg_check_num(n_args, n_kw, n_pos, n_pos, true);
+
+  ellipse_obj_t *self = m_new_obj(ellipse_obj_t);
+  self->base.type = (mp_obj_type_t *)type;
+
+  init_transform(&(self->ell.tr));
+
+  mp_map_t kwargs;
+  mp_map_init_fixed_table(&kwargs, n_kw, args + n_args);
+
+  static const mp_arg_t allowed_args[] = {
+    { MP_QSTR_fill, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    { MP_QSTR_stroke, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    { MP_QSTR_width, MP_ARG_INT, {.u_int = 3} },
+  };
+
+  mp_arg_val_t parsed_args[MP_ARRAY_SIZE(allowed_args)];
+  mp_arg_parse_all(0, args, &kwargs, MP_ARRAY_SIZE(allowed_args), allowed_args, parsed_args);
+
+  self->ell.fill = false;
+  self->ell.stroke = false;
+  if (mp_obj_is_int(parsed_args[0].u_obj)) {
+    self->ell.fclr = mp_obj_get_int(parsed_args[0].u_obj);
+    self->ell.fill = true;
+  } else if (mp_obj_is_int(parsed_args[1].u_obj)) {
+    self->ell.sclr = mp_obj_get_int(parsed_args[1].u_obj);
+    self->ell.stroke = true;
+  } else {
+    mp_raise_ValueError(MP_ERROR_TEXT("Must provide at least one of the fill or stroke arguments."));
+  }
+  self->ell.width = parsed_args[2].u_int;
+  if (self->ell.width < 1)
+    mp_raise_ValueError(MP_ERROR_TEXT("Stoke width must be at least 1"));
+
+  int rx = mp_obj_get_int(args[0]);
+  int ry = mp_obj_get_int(args[1]);
+  if (rx < 1 || ry < 1)
+    mp_raise_ValueError(MP_ERROR_TEXT("Radius must be at least 1"));
+  self->ell.rx = rx;
+  self->ell.ry = ry;
+  self->ell.start = 0;
+  self->ell.sweep = 360;
+
+  return self;
+}
+
+static void ellipse_print_style(const mp_print_t *print, ellipse_t *ell) {
+  if (ell->fill)
+    mp_printf(print, ",fill=color%d", ell->fclr);
+  if (ell->stroke) {
+    mp_printf(print, ",stroke=color%d,width=%d", ell->sclr, ell->width);
+  }
+  mp_printf(print, ")@");
+  transform_print(print, &(ell->tr));
+}
+
+static mp_obj_t ellipse_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+  return MP_OBJ_FROM_PTR(ellipse_new(type, 2, n_args, n_kw, args));
+}
+
+static void ellipse_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+  (void)kind;
+
+  ellipse_obj_t * self = (ellipse_obj_t *)MP_OBJ_TO_PTR(self_in);
+  mp_printf(print, "Ellipse(%d x %d", self->ell.rx, self->ell.ry);
+  ellipse_print_style(print, &(self->ell));
+}
+
+static const mp_rom_map_elem_t ellipse_locals_dict_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_position), MP_ROM_PTR(&set_position_obj) },
+  { MP_ROM_QSTR(MP_QSTR_rotate), MP_ROM_PTR(&set_rotation_obj) },
+  { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&set_scale_obj) },
+  { MP_ROM_QSTR(MP_QSTR_pivot), MP_ROM_PTR(&set_pivot_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(ellipse_locals_dict, ellipse_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    ellipse_type,
+    MP_QSTR_Ellipse,
+    MP_TYPE_FLAG_NONE,
+    make_new, (const void *)ellipse_make_new,
+    print, (const void *)ellipse_print,
+    locals_dict, &ellipse_locals_dict
+);
+
+
+//////////////////////////////////////// Arc
+
+// Arc(rx, ry, start, end, ...) runs clockwise from start to end, in
+// degrees from 3 o'clock. A filled arc is a pie slice.
+static mp_obj_t arc_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+  ellipse_obj_t *self = ellipse_new(type, 4, n_args, n_kw, args);
+
+  int start = mp_obj_get_int(args[2]);
+  int sweep = (mp_obj_get_int(args[3]) - start) % 360;
+  if (sweep <= 0)
+    sweep += 360;
+  self->ell.start = start % 360;
+  self->ell.sweep = sweep;
+
+  return MP_OBJ_FROM_PTR(self);
+}
+
+static void arc_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+  (void)kind;
+
+  ellipse_obj_t * self = (ellipse_obj_t *)MP_OBJ_TO_PTR(self_in);
+  mp_printf(print, "Arc(%d x %d,%d..%d", self->ell.rx, self->ell.ry,
+	    self->ell.start, (self->ell.start + self->ell.sweep) % 360);
+  ellipse_print_style(print, &(self->ell));
+}
+
+static const mp_rom_map_elem_t arc_locals_dict_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_position), MP_ROM_PTR(&set_position_obj) },
+  { MP_ROM_QSTR(MP_QSTR_rotate), MP_ROM_PTR(&set_rotation_obj) },
+  { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&set_scale_obj) },
+  { MP_ROM_QSTR(MP_QSTR_pivot), MP_ROM_PTR(&set_pivot_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(arc_locals_dict, arc_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    arc_type,
+    MP_QSTR_Arc,
+    MP_TYPE_FLAG_NONE,
+    make_new, (const void *)arc_make_new,
+    print, (const void *)arc_print,
+    locals_dict, &arc_locals_dict
+);
+
+
+//////////////////////////////////////// Bitmap
+
+typedef struct bitmap_obj_s {
+  mp_obj_base_t base;
+  bitmap_t bmp;
+  uint8_t bpp;
+} bitmap_obj_t;
+
+// Bitmap(w, h, data, colors): data holds w x h pixels packed MSB first,
+// each row padded to a byte. colors is one color for a 1 bit image, or
+// a tuple of up to 3 for pixel values 1..3 of a 2 bit one. Pixels of
+// value 0 are clear. The image is kept run-length encoded by row, and
+// can be positioned but not rotated or scaled.
+static mp_obj_t bitmap_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+  mp_arg_check_num(n_args, n_kw, 4, 4, false);
+
+  mp_buffer_info_t bufinfo;
+  uint8_t clr[3] = {0, 0, 0};
+  mp_obj_t *list;
+  size_t n_clr, i;
+
+  bitmap_obj_t *self = m_new_obj(bitmap_obj_t);
+  self->base.type = (mp_obj_type_t *)type;
+
+  init_transform(&(self->bmp.tr));
+
+  int w = mp_obj_get_int(args[0]);
+  int h = mp_obj_get_int(args[1]);
+  if (w < 1 || w > 4096 || h < 1 || h > 4096)
+    mp_raise_ValueError(MP_ERROR_TEXT("Bitmap size out of range 1..4096"));
+  self->bmp.w = w;
+  self->bmp.h = h;
+
+  if (mp_obj_is_int(args[3])) {
+    clr[0] = mp_obj_get_int(args[3]);
+    self->bpp = 1;
+  } else {
+    mp_obj_get_array(args[3], &n_clr, &list);
+    if (n_clr < 1 || n_clr > 3)
+      mp_raise_ValueError(MP_ERROR_TEXT("Need 1 to 3 colors"));
+    for (i = 0; i < n_clr; i++)
+      clr[i] = mp_obj_get_int(list[i]);
+    self->bpp = (n_clr == 1) ? 1 : 2;
+  }
+
+  mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
+  if (bufinfo.len < (size_t)((w * self->bpp + 7) / 8) * h)
+    mp_raise_ValueError(MP_ERROR_TEXT("Bitmap data too short"));
+  bitmap_encode(&(self->bmp), (const uint8_t *)bufinfo.buf, self->bpp, clr);
+
+  return MP_OBJ_FROM_PTR(self);
+}
+
+static void bitmap_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+  (void)kind;
+
+  bitmap_obj_t * self = (bitmap_obj_t *)MP_OBJ_TO_PTR(self_in);
+  mp_printf(print, "Bitmap(%d x %d,%d bit,%d runs)@", self->bmp.w, self->bmp.h, self->bpp,
+	    self->bmp.rows[self->bmp.h]);
+  transform_print(print, &(self->bmp.tr));
+}
+
+static const mp_rom_map_elem_t bitmap_locals_dict_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_position), MP_ROM_PTR(&set_position_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(bitmap_locals_dict, bitmap_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    bitmap_type,
+    MP_QSTR_Bitmap,
+    MP_TYPE_FLAG_NONE,
+    make_new, (const void *)bitmap_make_new,
+    print, (const void *)bitmap_print,
+    locals_dict, &bitmap_locals_dict
+);
+
+
+//////////////////////////////////////// Text
+
+typedef struct text_obj_s {
+  mp_obj_base_t base;
+  text_t text;
+  mp_obj_t str; // string the runs were built from
+} text_obj_t;
+
+// Rebuild the runs only when the string actually changes
+static void set_text_str(text_obj_t *self, mp_obj_t str_in) {
+  size_t len;
+  const char *s = mp_obj_str_get_data(str_in, &len);
+
+  if (self->str != MP_OBJ_NULL && mp_obj_equal(self->str, str_in))
+    return;
+  if (len > 255)
+    mp_raise_ValueError(MP_ERROR_TEXT("Text longer than 255"));
+  text_encode(&(self->text), s, len);
+  self->text.bmp.tr.rev++;
+  self->str = str_in;
+}
+
+// Text(string, color): one line of text in the display font, with its
+// top left corner at the position. It can be positioned but not rotated
+// or scaled.
+static mp_obj_t text_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+  mp_arg_check_num(n_args, n_kw, 2, 2, false);
+
+  text_obj_t *self = m_new_obj(text_obj_t);
+  self->base.type = (mp_obj_type_t *)type;
+
+  init_transform(&(self->text.bmp.tr));
+  self->text.bmp.runs = NULL;
+  self->text.bmp.rows = NULL;
+  self->text.font = font_50_spans;
+  self->text.index = font_50_spans_index;
+  self->text.clr = mp_obj_get_int(args[1]);
+  self->text.cap = 0;
+  self->str = MP_OBJ_NULL;
+  set_text_str(self, args[0]);
+
+  return MP_OBJ_FROM_PTR(self);
+}
+
+static void text_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+  (void)kind;
+
+  text_obj_t * self = (text_obj_t *)MP_OBJ_TO_PTR(self_in);
+  mp_printf(print, "Text(");
+  mp_obj_print_helper(print, self->str, PRINT_REPR);
+  mp_printf(print, ",color%d)@", self->text.clr);
+  transform_print(print, &(self->text.bmp.tr));
+}
+
+// set_text(string)
+static mp_obj_t text_set_text(mp_obj_t self_in, mp_obj_t str_in) {
+  text_obj_t *self = (text_obj_t *)MP_OBJ_TO_PTR(self_in);
+  set_text_str(self, str_in);
+  return self_in;
+}
+
+static MP_DEFINE_CONST_FUN_OBJ_2(text_set_text_obj, text_set_text);
+
+static const mp_rom_map_elem_t text_locals_dict_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_set_text), MP_ROM_PTR(&text_set_text_obj) },
+  { MP_ROM_QSTR(MP_QSTR_position), MP_ROM_PTR(&set_position_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(text_locals_dict, text_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    text_type,
+    MP_QSTR_Text,
+    MP_TYPE_FLAG_NONE,
+    make_new, (const void *)text_make_new,
+    print, (const void *)text_print,
+    locals_dict, &text_locals_dict
+);
+
 //////////////////////////////////////// Dynamic methods
 
 static transform_t *get_transform(mp_obj_t obj) {
@@ -385,10 +849,62 @@ static transform_t *get_transform(mp_obj_t obj) {
   } else if (otype == &polygon_type || otype == &polyline_type || otype == &line_type) {
     polygon_obj_t *polygon_obj = (polygon_obj_t *)MP_OBJ_TO_PTR(obj);
     tr = &(polygon_obj->poly.tr);
+  } else if (otype == &ellipse_type || otype == &arc_type) {
+    ellipse_obj_t *ellipse_obj = (ellipse_obj_t *)MP_OBJ_TO_PTR(obj);
+    tr = &(ellipse_obj->ell.tr);
+  } else if (otype == &bitmap_type) {
+    bitmap_obj_t *bitmap_obj = (bitmap_obj_t *)MP_OBJ_TO_PTR(obj);
+    tr = &(bitmap_obj->bmp.tr);
+  } else if (otype == &text_type) {
+    text_obj_t *text_obj = (text_obj_t *)MP_OBJ_TO_PTR(obj);
+    tr = &(text_obj->text.bmp.tr);
   }
   return tr;
 }
 
+// The ellipse iterator only draws upright axes: an ellipse that is not a
+// circle once scaled cannot turn by less than a quarter turn
+static void check_linear(mp_obj_t obj, int deg, int32_t sx, int32_t sy) {
+  const mp_obj_type_t *otype = mp_obj_get_type(obj);
+  if (otype == &ellipse_type || otype == &arc_type) {
+    ellipse_t *ell = &(((ellipse_obj_t *)MP_OBJ_TO_PTR(obj))->ell);
+    if (deg % 90 != 0 && (int64_t)ell->rx * sx != (int64_t)ell->ry * sy)
+      mp_raise_ValueError(MP_ERROR_TEXT("Ellipse can only turn by multiples of 90 degrees"));
+  }
+}
+
+static bool get_bounds(mp_obj_t obj, bbox_t *bb) {
+  const mp_obj_type_t *otype = mp_obj_get_type(obj);
+  if (otype == &rect_type) {
+    rect_obj_t *rect_obj = (rect_obj_t *)MP_OBJ_TO_PTR(obj);
+    rectangle_bounds(&(rect_obj->rect), bb);
+    return true;
+  } else if (otype == &polygon_type || otype == &polyline_type || otype == &line_type) {
+    polygon_obj_t *polygon_obj = (polygon_obj_t *)MP_OBJ_TO_PTR(obj);
+    polygon_bounds(&(polygon_obj->poly), bb);
+    return true;
+  } else if (otype == &ellipse_type || otype == &arc_type) {
+    ellipse_obj_t *ellipse_obj = (ellipse_obj_t *)MP_OBJ_TO_PTR(obj);
+    ellipse_bounds(&(ellipse_obj->ell), bb);
+    return true;
+  } else if (otype == &bitmap_type) {
+    bitmap_obj_t *bitmap_obj = (bitmap_obj_t *)MP_OBJ_TO_PTR(obj);
+    bitmap_bounds(&(bitmap_obj->bmp), bb);
+    return true;
+  } else if (otype == &text_type) {
+    text_obj_t *text_obj = (text_obj_t *)MP_OBJ_TO_PTR(obj);
+    bitmap_bounds(&(text_obj->text.bmp), bb);
+    return true;
+  }
+  return false;
+}
+
+
+static bool on_screen(mp_obj_t obj) {
+  bbox_t bb;
+  return !get_bounds(obj, &bb) || vgr2d_visible(&bb);
+}
+
 
 //////////////////////////////////////// Compile
 
@@ -397,221 +913,667 @@ static iter_base_t *make_iter(mp_obj_t obj) {
   if (otype == &rect_type) {
     rect_obj_t *rect_obj = (rect_obj_t *)MP_OBJ_TO_PTR(obj);
     rectangle_t *rect = &(rect_obj->rect);
-    rect_iter_t *iter = (rect_iter_t *)m_malloc(sizeof(rect_iter_t));
+    if (!transform_identity(&rect->tr)) {
+      poly_iter_t *iter = (poly_iter_t *)vgr2d_alloc(sizeof(poly_iter_t), 1);
+      init_polygon_iter(rectangle_outline(rect), iter);
+      return (iter_base_t *)iter;
+    }
+    rect_iter_t *iter = (rect_iter_t *)vgr2d_alloc(sizeof(rect_iter_t), 1);
     init_rectangle_iter(rect, iter);
     return (iter_base_t *)iter;
   } else if (otype == &polygon_type || otype == &polyline_type || otype == &line_type) {
     polygon_obj_t *polygon_obj = (polygon_obj_t *)MP_OBJ_TO_PTR(obj);
     polygon_t *poly = &(polygon_obj->poly);
-    poly_iter_t *iter = (poly_iter_t *)m_malloc(sizeof(poly_iter_t));
+    poly_iter_t *iter = (poly_iter_t *)vgr2d_alloc(sizeof(poly_iter_t), 1);
     init_polygon_iter(poly, iter);
     return (iter_base_t *)iter;
+  } else if (otype == &ellipse_type || otype == &arc_type) {
+    ellipse_obj_t *ellipse_obj = (ellipse_obj_t *)MP_OBJ_TO_PTR(obj);
+    ellipse_t *ell = &(ellipse_obj->ell);
+    ellipse_iter_t *iter = (ellipse_iter_t *)vgr2d_alloc(sizeof(ellipse_iter_t), 1);
+    init_ellipse_iter(ell, iter);
+    return (iter_base_t *)iter;
+  } else if (otype == &bitmap_type) {
+    bitmap_obj_t *bitmap_obj = (bitmap_obj_t *)MP_OBJ_TO_PTR(obj);
+    bitmap_iter_t *iter = (bitmap_iter_t *)vgr2d_alloc(sizeof(bitmap_iter_t), 1);
+    init_bitmap_iter(&(bitmap_obj->bmp), iter);
+    return (iter_base_t *)iter;
+  } else if (otype == &text_type) {
+    text_obj_t *text_obj = (text_obj_t *)MP_OBJ_TO_PTR(obj);
+    bitmap_iter_t *iter = (bitmap_iter_t *)vgr2d_alloc(sizeof(bitmap_iter_t), 1);
+    init_bitmap_iter(&(text_obj->text.bmp), iter);
+    return (iter_base_t *)iter;
   }
   return NULL;
 }
 
-static void sort_runs(uint16_t *runs, uint8_t *clr, int n) {
-  uint8_t c;
-  uint16_t x1, x2;
-  
-  for (int i = 0; i < n; i++) {
-    for (int j = n-1; j > i; j--) {
-      int ri = j<<1;
-      if (runs[ri-2] > runs[ri]) {
-	c = clr[j-1];
-	x1 = runs[ri-2];
-	x2 = runs[ri-1];
-	runs[ri-2] = runs[ri];
-	runs[ri-1] = runs[ri+1];
-	clr[j-1] = clr[j];
-	runs[ri] = x1;
-	runs[ri+1] = x2;
-	clr[j] = c;
-      }
-    }
-  }
-  for (int i = 1; i < n; i++) {
-    int ri = i<<1;
-    int dx = (int)runs[ri]-(int)(runs[ri-1]+1);
-    if (dx < MIN_DX) {
-      runs[ri] = runs[ri-1]+1;
-      if (runs[ri] > runs[ri+1]) // close small gaps
-	runs[ri] = runs[ri+1]; // will be discarded later
-    }
-  }
+#define CMDBUF_INIT 256
+#define CMDBUF_MIN 32
+
+void vgr2d_cmd_grow(cmdbuf_t *out) {
+  if (out->fixed)
+    mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small for commands"));
+  size_t n = (out->alloc > 0) ? out->alloc << 1 : CMDBUF_MIN;
+  out->buf = m_renew(uint8_t, out->buf, out->alloc, n);
+  out->alloc = n;
 }
 
-static mp_obj_t generate(mp_obj_t addr_in, mp_obj_t list_in) {
-  uint16_t addr = mp_obj_get_int(addr_in);
+// Size of the last command stream encoded, and the bytes the peephole
+// pass took off it, for stats()
+static size_t last_len, last_saved;
 
+// Resets the arena, the caller resets it again once done with the
+// iterators
+static iter_base_t **make_iters(mp_obj_t list_in, int *n) {
   size_t list_len = 0;
   mp_obj_t *list = NULL;
   mp_obj_list_get(list_in, &list_len, &list);
   int len = (int)list_len;
 
-  uint16_t cmd;
-  uint16_t curY, y, prevY;
-  uint16_t x1, x2, dx, s, curX;
-  uint8_t c;
-  int i, ri;
+  arena_reset();
 
-  iter_base_t ** iters =(iter_base_t **)m_malloc(len * sizeof(iter_base_t*));
+  // shapes entirely off screen get no iterator at all
+  iter_base_t ** iters =(iter_base_t **)vgr2d_alloc(sizeof(iter_base_t*), len);
+  *n = 0;
   for (int i = 0; i < len; i++)
-    iters[i] = make_iter(list[i]);
+    if (on_screen(list[i]))
+      iters[(*n)++] = make_iter(list[i]);
+  return iters;
+}
 
-  uint16_t * runs = (uint16_t *)m_malloc(2 * MAX_RUNS * sizeof(uint16_t));
-  uint8_t * clr = (uint8_t *)m_malloc(MAX_RUNS * sizeof(uint8_t));
+static void encode(uint16_t addr, mp_obj_t list_in, cmdbuf_t *out) {
+  int n;
+  iter_base_t **iters = make_iters(list_in, &n);
 
-  mp_obj_t return_list = mp_obj_new_list(0, NULL);
+  size_t start = out->len;
+  out->saved = 0;
+  vgr2d_encode(addr, iters, n, out);
+  last_len = out->len - start;
+  last_saved = out->saved;
 
-  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(addr>>8));
-  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(addr&0xff));
-  
-  prevY = 0xffff;
-  do {
-    // find next closest line
-    curY = 0xffff;
-    for (i = 0; i < len; i++) {
-      if (iters[i] != NULL) {
-	if (iters[i]->nextLine(iters[i], &y)) {
-	  if (y < curY)
-	    curY = y;
-	} else {
-	  MFREE(iters[i], iters[i]->size);
-	  iters[i] = NULL;
-	}
-      }
-    }
-    if (curY == 0xffff) break;
-
-    // collect runs on this line
-    ri = 0;
-    for (i = 0; i < len; i++) {
-      if (iters[i] != NULL) {
-	while (iters[i]->nextRun(iters[i], curY, &x1, &x2, &c)) {
-	  if (x2 > x1 && (ri>>1) < MAX_RUNS) {
-	    clr[ri>>1] = c;
-	    runs[ri++] = x1;
-	    runs[ri++] = x2;
-	  }
-	}
-      }
-    }
+  // iterators, edges and run buffers all go at once
+  arena_reset();
+}
 
-    if (ri > 0) {
-      sort_runs(runs, clr, ri>>1);
-
-      x1 = runs[0];
-      if (curY > 0) {
-	if (curY == (prevY+1) && x1 <= MAX_NLX) {
-	  cmd = 0xa000|x1;
-	  curX = x1;
-	} else {
-	  cmd = 0xf000|curY;
-	  curX = 0;
-	}
-	mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd>>8));
-	mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd&0xff));
-      }
-      for (i = 0; i < ri; i+=2) {
-	s = runs[i+1] - runs[i];
-	if (s < MIN_DX)
-	  continue;
-
-	dx = runs[i] - curX;
-	if (dx > 0 && dx < MIN_DX) {
-	  printf("ERR");
-	  for (int k = 0; k < ri; k+=2)
-	    printf(" %d,%d",runs[k],runs[k+1]);
-	  printf("\n");
-	}
-	while (dx > MAX_DX) {
-	  cmd = 0x8000|MAX_DX;
-	  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd>>8));
-	  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd&0xff));
-	  dx -= MAX_DX;
-	}
-	if (dx > 0) {
-	  cmd = 0x8000|dx;
-	  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd>>8));
-	  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd&0xff));
-	}
-	
-	if (s > MAX_CLRX) {
-	  cmd = (((uint16_t)clr[i>>1])<<8)|MAX_CLRX;
-	  s -= MAX_CLRX;
-	} else {
-	  cmd = (((uint16_t)clr[i>>1])<<8)|s;
-	  s = 0;
-	}
-	mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd>>8));
-	mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd&0xff));
-	while (s > MAX_SPANX) {
-	  cmd = 0xc000|MAX_SPANX;
-	  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd>>8));
-	  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd&0xff));
-	  s -= MAX_SPANX;
-	}
-	if (s > 0) {
-	  cmd = 0xc000|s;
-	  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd>>8));
-	  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(cmd&0xff));
-	}
-	
-	curX = runs[i+1] + 1;
-      }
-      prevY = curY;
-    } else {
-      // on fail revert curY
-      curY = prevY;
-    }
-  } while (true);
+// generate(addr, shapes[, buf])
+// Returns the packed command bytes as a bytearray, or when a writable
+// buffer is given, fills it and returns the number of bytes written.
+static mp_obj_t generate(size_t n_args, const mp_obj_t *args) {
+  uint16_t addr = mp_obj_get_int(args[0]);
+  cmdbuf_t out;
+
+  if (n_args > 2) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_WRITE);
+    out.buf = (uint8_t *)bufinfo.buf;
+    out.len = 0;
+    out.alloc = bufinfo.len;
+    out.fixed = true;
+    encode(addr, args[1], &out);
+    return MP_OBJ_NEW_SMALL_INT(out.len);
+  }
 
-  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(0xff));
-  mp_obj_list_append(return_list, MP_OBJ_NEW_SMALL_INT(0xff));
+  out.buf = m_new(uint8_t, CMDBUF_INIT);
+  out.len = 0;
+  out.alloc = CMDBUF_INIT;
+  out.fixed = false;
+  encode(addr, args[1], &out);
+  out.buf = m_renew(uint8_t, out.buf, out.alloc, out.len);
+  return mp_obj_new_bytearray_by_ref(out.len, out.buf);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(generate_fun, 2, 3, generate);
 
-  for (i = 0; i < len; i++) {
-    if (iters[i] != NULL) {
-      MFREE(iters[i], iters[i]->size);
-    }
+#define SPI_SIZE 128
+
+static void send_start(void) {
+  uint8_t start[2];
+
+  start[0] = fpga_graphics_dev();
+  start[1] = 0x03;
+  fpga_write_internal(start, 2, true);
+}
+
+// Stream straight out of a command buffer, releasing CS after the last
+// byte unless more follows.
+static void send_cmds(uint8_t *buf, size_t len, bool more) {
+  for (size_t i = 0; len > 0; ) {
+    size_t sz = (len <= SPI_SIZE) ? len : SPI_SIZE;
+    fpga_write_internal(buf + i, sz, more || len > sz);
+    i += sz;
+    len -= sz;
   }
+}
 
-  MFREE(clr, MAX_RUNS * sizeof(uint8_t));
-  MFREE(runs, 2 * MAX_RUNS * sizeof(uint16_t));
-  MFREE(iters, len * sizeof(iter_base_t*));
-  
-  return MP_OBJ_FROM_PTR(return_list);
+//////////////////////////////////////// Compiled streams
+
+typedef struct stream_obj_s {
+  mp_obj_base_t base;
+  compiled_t c;
+} stream_obj_t;
+
+static void stream_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+  (void)kind;
+
+  stream_obj_t *self = (stream_obj_t *)MP_OBJ_TO_PTR(self_in);
+  mp_printf(print, "Stream(%d lines,%d bytes)", (int)(self->c.lines.len / 6),
+	    (int)self->c.body.len);
 }
 
-const mp_obj_fun_builtin_fixed_t generate_fun = {{&mp_type_fun_builtin_2}, {._2 = &generate}};
+MP_DEFINE_CONST_OBJ_TYPE(
+    stream_type,
+    MP_QSTR_Stream,
+    MP_TYPE_FLAG_NONE,
+    print, (const void *)stream_print
+);
 
-#define SPI_SIZE 128
+static void stream_buf_init(cmdbuf_t *buf) {
+  buf->buf = m_new(uint8_t, CMDBUF_INIT);
+  buf->len = 0;
+  buf->alloc = CMDBUF_INIT;
+  buf->fixed = false;
+}
 
-static mp_obj_t display2d(mp_obj_t addr_in, mp_obj_t list_in) {
-  mp_obj_t ops = generate(addr_in, list_in);
+static void stream_buf_trim(cmdbuf_t *buf) {
+  if (buf->len > 0 && buf->len < buf->alloc) {
+    buf->buf = m_renew(uint8_t, buf->buf, buf->alloc, buf->len);
+    buf->alloc = buf->len;
+  }
+}
 
-  uint8_t *buf = (uint8_t *)m_malloc(128);
-  
-  size_t len = 0;
-  mp_obj_t *list = NULL;
-  mp_obj_list_get(ops, &len, &list);
+// compile(shapes) -> Stream
+// Rasterizes the shapes once, as they are placed, into a stream that
+// display2d() can send at any origin without touching the shapes again.
+static mp_obj_t compile(mp_obj_t list_in) {
+  stream_obj_t *self = m_new_obj(stream_obj_t);
+  self->base.type = &stream_type;
+  stream_buf_init(&(self->c.body));
+  stream_buf_init(&(self->c.lines));
+
+  int n;
+  iter_base_t **iters = make_iters(list_in, &n);
+  vgr2d_compile(iters, n, &(self->c));
+  arena_reset();
+
+  stream_buf_trim(&(self->c.body));
+  stream_buf_trim(&(self->c.lines));
+  return MP_OBJ_FROM_PTR(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(compile_fun, compile);
 
-  buf[0] = fpga_graphics_dev();
-  buf[1] = 0x03;
-  fpga_write_internal(buf, 2, true);
 
-  for (unsigned i = 0; len > 0; ) {
-    unsigned sz = (len <= SPI_SIZE) ? len : SPI_SIZE;
-    for (unsigned j = 0; j < sz; j++)
-      buf[j] = mp_obj_get_int(list[i+j]);
-    fpga_write_internal(buf, sz, len > sz);
-    i += sz;
-    len -= sz;
+//////////////////////////////////////// Background display
+
+// display2d() encodes into one of two command buffers while the other may
+// still be going out on EasyDMA, then queues the new one behind it. Each
+// buffer starts with the write header and is kept for reuse.
+
+MP_REGISTER_ROOT_POINTER(uint8_t *rvgr_dma_buf[2]);
+
+MP_REGISTER_ROOT_POINTER(uint32_t *rvgr_line_hash);
+
+static size_t dma_alloc[2];
+static int dma_cur;       // buffer handed to the DMA last
+static uint32_t dma_seq;  // streams started
+static bool line_hash_valid; // the FPGA holds the lines hashed last
+
+typedef struct transfer_obj_s {
+  mp_obj_base_t base;
+  uint32_t seq;
+  bool queued;
+} transfer_obj_t;
+
+static bool transfer_done(transfer_obj_t *self) {
+  return self->seq != dma_seq || !fpga_write_busy();
+}
+
+// done() -> True once the frame has gone out
+static mp_obj_t transfer_done_meth(mp_obj_t self_in) {
+  transfer_obj_t *self = (transfer_obj_t *)MP_OBJ_TO_PTR(self_in);
+  return mp_obj_new_bool(transfer_done(self));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(transfer_done_obj, transfer_done_meth);
+
+// wait(): block until the frame has gone out
+static mp_obj_t transfer_wait(mp_obj_t self_in) {
+  transfer_obj_t *self = (transfer_obj_t *)MP_OBJ_TO_PTR(self_in);
+  while (!transfer_done(self))
+    MICROPY_EVENT_POLL_HOOK
+  return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(transfer_wait_obj, transfer_wait);
+
+// "await transfer" is a yield from this iterator. Like the uasyncio
+// streams, it parks the task on the poller once, which wakes it when
+// the ioctl below reports the stream has ended.
+static mp_obj_t transfer_iternext(mp_obj_t self_in) {
+  transfer_obj_t *self = (transfer_obj_t *)MP_OBJ_TO_PTR(self_in);
+
+  if (self->queued || transfer_done(self)) {
+    self->queued = false;
+    return MP_OBJ_STOP_ITERATION;
+  }
+  mp_obj_t uasyncio = mp_import_name(MP_QSTR_uasyncio, mp_const_none, MP_OBJ_NEW_SMALL_INT(0));
+  mp_obj_t core = mp_load_attr(uasyncio, MP_QSTR_core);
+  mp_obj_t io_queue = mp_load_attr(core, MP_QSTR__io_queue);
+  mp_obj_t queue_read = mp_load_attr(io_queue, MP_QSTR_queue_read);
+  self->queued = true;
+  return mp_call_function_1(queue_read, self_in);
+}
+
+static mp_uint_t transfer_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+  transfer_obj_t *self = (transfer_obj_t *)MP_OBJ_TO_PTR(self_in);
+
+  if (request != MP_STREAM_POLL) {
+    *errcode = MP_EINVAL;
+    return MP_STREAM_ERROR;
+  }
+  return (transfer_done(self)) ? (arg & MP_STREAM_POLL_RD) : 0;
+}
+
+static const mp_stream_p_t transfer_stream_p = {
+  .ioctl = transfer_ioctl,
+};
+
+static const mp_rom_map_elem_t transfer_locals_dict_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_done), MP_ROM_PTR(&transfer_done_obj) },
+  { MP_ROM_QSTR(MP_QSTR_wait), MP_ROM_PTR(&transfer_wait_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(transfer_locals_dict, transfer_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    transfer_type,
+    MP_QSTR_Transfer,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
+    iter, transfer_iternext,
+    protocol, &transfer_stream_p,
+    locals_dict, &transfer_locals_dict
+);
+
+// Encode only the lines that changed since the last delta frame
+static void encode_delta(uint16_t addr, mp_obj_t list_in, cmdbuf_t *out) {
+  if (MP_STATE_VM(rvgr_line_hash) == NULL) {
+    MP_STATE_VM(rvgr_line_hash) = m_new(uint32_t, VIEW_HEIGHT);
+    line_hash_valid = false;
+  }
+
+  // hashes updated by a frame that failed to encode match nothing sent
+  bool valid = line_hash_valid;
+  line_hash_valid = false;
+
+  int n;
+  iter_base_t **iters = make_iters(list_in, &n);
+  size_t start = out->len;
+  vgr2d_encode_delta(addr, iters, n, MP_STATE_VM(rvgr_line_hash), valid, out);
+  line_hash_valid = true;
+  last_len = out->len - start;
+  last_saved = 0;
+  arena_reset();
+}
+
+// display2d(addr, shapes, delta=False) -> Transfer
+// display2d(addr, stream, x, y) -> Transfer
+// Returns as soon as the frame is queued. The Transfer can be awaited,
+// polled with done() or waited on, and any other SPI access waits for the
+// stream first anyway. A compiled stream is only re-addressed for its
+// origin x, y, and must fit the view there. With delta=True only the
+// lines that differ from the last delta frame are sent, relying on the
+// FPGA keeping the others; any other frame sent in between makes the next
+// delta frame send every line.
+static mp_obj_t display2d(size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+  static const mp_arg_t allowed_args[] = {
+    { MP_QSTR_delta, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+  };
+
+  mp_arg_val_t parsed_args[MP_ARRAY_SIZE(allowed_args)];
+  mp_arg_parse_all(0, args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, parsed_args);
+  bool delta = parsed_args[0].u_bool;
+
+  if (n_args > 4)
+    mp_raise_TypeError(MP_ERROR_TEXT("Too many arguments"));
+  uint16_t addr = mp_obj_get_int(args[0]);
+  stream_obj_t *stream = NULL;
+  int i = 1 - dma_cur;
+  mp_int_t x = 0, y = 0;
+  cmdbuf_t out;
+
+  if (mp_obj_is_type(args[1], &stream_type)) {
+    if (delta)
+      mp_raise_ValueError(MP_ERROR_TEXT("delta is for shapes"));
+    if (n_args != 4)
+      mp_raise_TypeError(MP_ERROR_TEXT("Stream needs x and y"));
+    stream = (stream_obj_t *)MP_OBJ_TO_PTR(args[1]);
+    x = mp_obj_get_int(args[2]);
+    y = mp_obj_get_int(args[3]);
+    if (stream->c.lines.len > 0 &&
+	(x < 0 || y < 0 || x >= VIEW_WIDTH || y >= VIEW_HEIGHT ||
+	 XFX(x) + stream->c.x2 > VIEW_XMAX || y + stream->c.y2 >= VIEW_HEIGHT))
+      mp_raise_ValueError(MP_ERROR_TEXT("Stream does not fit the view at x, y"));
+  } else if (n_args != 2)
+    mp_raise_TypeError(MP_ERROR_TEXT("x and y are for a Stream"));
+
+  out.buf = MP_STATE_VM(rvgr_dma_buf)[i];
+  if (out.buf == NULL) {
+    out.buf = m_new(uint8_t, CMDBUF_INIT);
+    MP_STATE_VM(rvgr_dma_buf)[i] = out.buf;
+    dma_alloc[i] = CMDBUF_INIT;
+  }
+  out.alloc = dma_alloc[i];
+  out.fixed = false;
+  out.buf[0] = fpga_graphics_dev();
+  out.buf[1] = 0x03;
+  out.len = 2;
+
+  // Growing the buffer frees the old block, so the root has to follow it
+  // even when the encoding raises afterwards.
+  nlr_buf_t nlr;
+  if (nlr_push(&nlr) == 0) {
+    if (stream != NULL) {
+      vgr2d_replay(addr, &(stream->c), XFX(x), y, &out);
+      last_len = out.len - 2;
+      last_saved = 0;
+    } else if (delta)
+      encode_delta(addr, args[1], &out);
+    else
+      encode(addr, args[1], &out);
+    nlr_pop();
+  } else {
+    MP_STATE_VM(rvgr_dma_buf)[i] = out.buf;
+    dma_alloc[i] = out.alloc;
+    nlr_jump(nlr.ret_val);
+  }
+  if (!delta)
+    line_hash_valid = false;
+  MP_STATE_VM(rvgr_dma_buf)[i] = out.buf;
+  dma_alloc[i] = out.alloc;
+
+  // waits for the previous frame, which frees its buffer for the next
+  fpga_write_background(out.buf, out.len);
+  dma_cur = i;
+
+  transfer_obj_t *t = m_new_obj(transfer_obj_t);
+  t->base.type = &transfer_type;
+  t->seq = ++dma_seq;
+  t->queued = false;
+  return MP_OBJ_FROM_PTR(t);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(display2d_fun, 2, display2d);
+
+
+//////////////////////////////////////// Scene
+
+// A retained list of shapes whose commands are cached per band of
+// BAND_HEIGHT lines. Shapes bump their transform revision when changed;
+// the scene compares revisions on every update and only re-encodes, and
+// sends, the bands a changed shape covered before or covers now. This
+// relies on the FPGA keeping the lines of bands that are not resent.
+
+typedef struct scene_item_s {
+  mp_obj_t shape;
+  uint16_t rev;   // shape revision last encoded
+  int y1, y2;     // lines covered when last encoded
+} scene_item_t;
+
+typedef struct scene_obj_s {
+  mp_obj_base_t base;
+  uint16_t addr;
+  scene_item_t *items;
+  size_t len, alloc;
+  uint32_t dirty;  // bands to re-encode
+  uint32_t unsent; // bands re-encoded since the last display
+  cmdbuf_t bands[NUM_BANDS];
+} scene_obj_t;
+
+static uint32_t rows_mask(int y1, int y2) {
+  if (y2 < 0 || y1 >= VIEW_HEIGHT || y2 < y1)
+    return 0;
+  if (y1 < 0) y1 = 0;
+  if (y2 >= VIEW_HEIGHT) y2 = VIEW_HEIGHT-1;
+  int b1 = y1 / BAND_HEIGHT, b2 = y2 / BAND_HEIGHT;
+  return (BAND_BIT(b2) << 1) - BAND_BIT(b1);
+}
+
+static transform_t *scene_check_shape(mp_obj_t shape) {
+  transform_t *tr = get_transform(shape);
+  if (tr == NULL)
+    mp_raise_TypeError(MP_ERROR_TEXT("Scene only holds rvgr shapes"));
+  return tr;
+}
+
+static mp_obj_t scene_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+  mp_arg_check_num(n_args, n_kw, 1, 1, false);
+
+  scene_obj_t *self = m_new_obj(scene_obj_t);
+  self->base.type = (mp_obj_type_t *)type;
+  self->addr = mp_obj_get_int(args[0]);
+  self->items = NULL;
+  self->len = 0;
+  self->alloc = 0;
+  self->dirty = rows_mask(0, VIEW_HEIGHT-1);
+  self->unsent = 0;
+  for (int b = 0; b < NUM_BANDS; b++) {
+    self->bands[b].buf = NULL;
+    self->bands[b].len = 0;
+    self->bands[b].alloc = 0;
+    self->bands[b].saved = 0;
+    self->bands[b].fixed = false;
+  }
+
+  return MP_OBJ_FROM_PTR(self);
+}
+
+static void scene_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+  (void)kind;
+
+  scene_obj_t *self = (scene_obj_t *)MP_OBJ_TO_PTR(self_in);
+  mp_printf(print, "Scene(%d shapes)", (int)self->len);
+}
+
+static mp_obj_t scene_add(mp_obj_t self_in, mp_obj_t shape) {
+  scene_obj_t *self = (scene_obj_t *)MP_OBJ_TO_PTR(self_in);
+  transform_t *tr = scene_check_shape(shape);
+  bbox_t bb;
+
+  if (self->len == self->alloc) {
+    size_t n = (self->alloc > 0) ? self->alloc << 1 : 8;
+    self->items = m_renew(scene_item_t, self->items, self->alloc, n);
+    self->alloc = n;
   }
-  MFREE(buf, 128);
+  get_bounds(shape, &bb);
+  scene_item_t *item = &self->items[self->len++];
+  item->shape = shape;
+  item->rev = tr->rev;
+  item->y1 = bb.y1;
+  item->y2 = bb.y2;
+  self->dirty |= rows_mask(bb.y1, bb.y2);
   return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(display2d_fun, display2d);
+static MP_DEFINE_CONST_FUN_OBJ_2(scene_add_obj, scene_add);
+
+static mp_obj_t scene_remove(mp_obj_t self_in, mp_obj_t shape) {
+  scene_obj_t *self = (scene_obj_t *)MP_OBJ_TO_PTR(self_in);
+
+  for (size_t i = 0; i < self->len; i++) {
+    scene_item_t *item = &self->items[i];
+    if (item->shape == shape) {
+      self->dirty |= rows_mask(item->y1, item->y2);
+      memmove(item, item+1, (self->len-i-1) * sizeof(scene_item_t));
+      self->len--;
+      self->items[self->len].shape = MP_OBJ_NULL;
+      return mp_const_none;
+    }
+  }
+  mp_raise_ValueError(MP_ERROR_TEXT("Shape not in scene"));
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(scene_remove_obj, scene_remove);
+
+static mp_obj_t scene_clear(mp_obj_t self_in) {
+  scene_obj_t *self = (scene_obj_t *)MP_OBJ_TO_PTR(self_in);
+
+  for (size_t i = 0; i < self->len; i++) {
+    self->dirty |= rows_mask(self->items[i].y1, self->items[i].y2);
+    self->items[i].shape = MP_OBJ_NULL;
+  }
+  self->len = 0;
+  return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(scene_clear_obj, scene_clear);
+
+// Mark the bands of changed shapes, then re-encode just those bands from
+// the shapes that cross them.
+static void scene_update(scene_obj_t *self) {
+  size_t i;
+  int n;
+  bbox_t bb;
+
+  for (i = 0; i < self->len; i++) {
+    scene_item_t *item = &self->items[i];
+    transform_t *tr = get_transform(item->shape);
+    if (tr->rev != item->rev) {
+      get_bounds(item->shape, &bb);
+      self->dirty |= rows_mask(item->y1, item->y2) | rows_mask(bb.y1, bb.y2);
+      item->rev = tr->rev;
+      item->y1 = bb.y1;
+      item->y2 = bb.y2;
+    }
+  }
+  if (self->dirty == 0)
+    return;
+
+  arena_reset();
+
+  iter_base_t **iters = (iter_base_t **)vgr2d_alloc(sizeof(iter_base_t*), self->len);
+  for (i = 0, n = 0; i < self->len; i++) {
+    scene_item_t *item = &self->items[i];
+    if ((rows_mask(item->y1, item->y2) & self->dirty) && on_screen(item->shape))
+      iters[n++] = make_iter(item->shape);
+  }
+  vgr2d_encode_bands(iters, n, self->dirty, self->bands);
+
+  arena_reset();
+
+  last_len = 0;
+  last_saved = 0;
+  for (int b = 0; b < NUM_BANDS; b++)
+    if (self->dirty & BAND_BIT(b)) {
+      last_len += self->bands[b].len;
+      last_saved += self->bands[b].saved;
+    }
+
+  self->unsent |= self->dirty;
+  self->dirty = 0;
+}
+
+// generate() -> bytearray
+// Returns the whole command stream, re-encoding changed bands first.
+static mp_obj_t scene_generate(mp_obj_t self_in) {
+  scene_obj_t *self = (scene_obj_t *)MP_OBJ_TO_PTR(self_in);
+  size_t len = 4;
+  uint8_t *buf, *p;
+
+  scene_update(self);
+  for (int b = 0; b < NUM_BANDS; b++)
+    len += self->bands[b].len;
+  p = buf = m_new(uint8_t, len);
+  *p++ = self->addr >> 8;
+  *p++ = self->addr & 0xff;
+  for (int b = 0; b < NUM_BANDS; b++) {
+    memcpy(p, self->bands[b].buf, self->bands[b].len);
+    p += self->bands[b].len;
+  }
+  *p++ = 0xff;
+  *p++ = 0xff;
+  return mp_obj_new_bytearray_by_ref(len, buf);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(scene_generate_obj, scene_generate);
+
+// display() -> int
+// Sends the bands that changed since the last display, all of them the
+// first time, and returns the number of bytes sent.
+static mp_obj_t scene_display(mp_obj_t self_in) {
+  scene_obj_t *self = (scene_obj_t *)MP_OBJ_TO_PTR(self_in);
+  uint8_t word[2];
+  size_t sent = 4;
+
+  scene_update(self);
+  if (self->unsent == 0)
+    return MP_OBJ_NEW_SMALL_INT(0);
+
+  line_hash_valid = false;
+  send_start();
+  word[0] = self->addr >> 8;
+  word[1] = self->addr & 0xff;
+  fpga_write_internal(word, 2, true);
+  for (int b = 0; b < NUM_BANDS; b++) {
+    if (self->unsent & BAND_BIT(b)) {
+      send_cmds(self->bands[b].buf, self->bands[b].len, true);
+      sent += self->bands[b].len;
+    }
+  }
+  word[0] = 0xff;
+  word[1] = 0xff;
+  fpga_write_internal(word, 2, false);
+  self->unsent = 0;
+  return MP_OBJ_NEW_SMALL_INT(sent);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(scene_display_obj, scene_display);
+
+static const mp_rom_map_elem_t scene_locals_dict_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&scene_add_obj) },
+  { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&scene_remove_obj) },
+  { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&scene_clear_obj) },
+  { MP_ROM_QSTR(MP_QSTR_generate), MP_ROM_PTR(&scene_generate_obj) },
+  { MP_ROM_QSTR(MP_QSTR_display), MP_ROM_PTR(&scene_display_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(scene_locals_dict, scene_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    scene_type,
+    MP_QSTR_Scene,
+    MP_TYPE_FLAG_NONE,
+    make_new, (const void *)scene_make_new,
+    print, (const void *)scene_print,
+    locals_dict, &scene_locals_dict
+);
+
+
+// arena([size]) -> (size, peak)
+// Optionally replaces the generate arena with one of the given size, and
+// returns its size and the peak bytes requested from it. A peak above the
+// size means allocations spilled to the heap.
+static mp_obj_t arena_config(size_t n_args, const mp_obj_t *args) {
+  if (n_args > 0) {
+    mp_int_t size = mp_obj_get_int(args[0]);
+    if (size < 256)
+      mp_raise_ValueError(MP_ERROR_TEXT("Arena size must be at least 256"));
+    if (MP_STATE_VM(rvgr_arena) != NULL)
+      MFREE(MP_STATE_VM(rvgr_arena), arena.size);
+    MP_STATE_VM(rvgr_arena) = m_new(uint8_t, size);
+    vgr2d_arena_init(&arena, MP_STATE_VM(rvgr_arena), size);
+  } else if (MP_STATE_VM(rvgr_arena) == NULL) {
+    arena_reset();
+  }
+  mp_obj_t tuple[2] = {
+    MP_OBJ_NEW_SMALL_INT(arena.size),
+    MP_OBJ_NEW_SMALL_INT(arena.peak)
+  };
+  return mp_obj_new_tuple(2, tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(arena_fun, 0, 1, arena_config);
+
+// stats() -> (bytes, saved)
+// Size of the last command stream generate() or display2d() produced, or
+// of the bands a Scene last re-encoded, and the bytes the peephole pass
+// saved on it.
+static mp_obj_t stats(void) {
+  mp_obj_t tuple[2] = {
+    mp_obj_new_int_from_uint(last_len),
+    mp_obj_new_int_from_uint(last_saved)
+  };
+  return mp_obj_new_tuple(2, tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(stats_fun, stats);
 
 static const mp_rom_map_elem_t module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_rvgr) },
@@ -619,8 +1581,19 @@ static const mp_rom_map_elem_t module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_Polygon), MP_ROM_PTR(&polygon_type) },
     { MP_ROM_QSTR(MP_QSTR_Polyline), MP_ROM_PTR(&polyline_type) },
     { MP_ROM_QSTR(MP_QSTR_Line), MP_ROM_PTR(&line_type) },
+    { MP_ROM_QSTR(MP_QSTR_Ellipse), MP_ROM_PTR(&ellipse_type) },
+    { MP_ROM_QSTR(MP_QSTR_Arc), MP_ROM_PTR(&arc_type) },
+    { MP_ROM_QSTR(MP_QSTR_Bitmap), MP_ROM_PTR(&bitmap_type) },
+    { MP_ROM_QSTR(MP_QSTR_Text), MP_ROM_PTR(&text_type) },
+    { MP_ROM_QSTR(MP_QSTR_Scene), MP_ROM_PTR(&scene_type) },
     { MP_ROM_QSTR(MP_QSTR_generate), MP_ROM_PTR(&generate_fun) },
     { MP_ROM_QSTR(MP_QSTR_display2d), MP_ROM_PTR(&display2d_fun) },
+    { MP_ROM_QSTR(MP_QSTR_compile), MP_ROM_PTR(&compile_fun) },
+    { MP_ROM_QSTR(MP_QSTR_arena), MP_ROM_PTR(&arena_fun) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&stats_fun) },
+    { MP_ROM_QSTR(MP_QSTR_MITER), MP_ROM_INT(JOIN_MITER) },
+    { MP_ROM_QSTR(MP_QSTR_BEVEL), MP_ROM_INT(JOIN_BEVEL) },
+    { MP_ROM_QSTR(MP_QSTR_ROUND), MP_ROM_INT(JOIN_ROUND) },
 };
 static MP_DEFINE_CONST_DICT(module_globals, module_globals_table);
 
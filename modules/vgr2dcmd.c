@@ -0,0 +1,650 @@
+/*
+
+Copyright 2023 StreamLogic, LLC.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#ifdef __MINGW32__
+#include <stdio.h>
+#else
+#define printf(...)
+#endif
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "vgr2dlib.h"
+#include "vgr2dcmd.h"
+
+#define MIN_RUNS 32
+
+#define MAX_DX 0x1fff // 9.4
+#define MAX_NLX 0x1fff // 9.4
+#define MAX_SPANX 0x1fff // 9.4
+#define MAX_CLRX 0xff // 4.4
+#define MIN_DX 0x10
+
+extern void *vgr2d_alloc(size_t size, int n);
+
+
+static void emit_cmd(cmdbuf_t *out, uint16_t cmd) {
+  if (out->len + 2 > out->alloc)
+    vgr2d_cmd_grow(out);
+  out->buf[out->len++] = cmd>>8;
+  out->buf[out->len++] = cmd&0xff;
+}
+
+//////////////////////////////////////// Runs
+
+// Runs of one line, and the visible spans left after resolving overlaps.
+// Shapes later in the list are drawn on top of earlier ones.
+
+// Heap entry: the next run of group g keyed on its x1, or the next line
+// of iterator g keyed on its y
+typedef struct head_s {
+  uint16_t key;
+  uint16_t g;
+} head_t;
+
+typedef struct runs_s {
+  run_t *run;   // grouped by iterator, each group sorted on x1
+  int n, max;
+  int *group;   // start of each group, k+1 entries
+  int *pos;     // next run of each group
+  head_t *heap;
+  int k;
+  int *active;  // runs covering the sweep position
+  run_t *span;  // visible spans in x order, at most 2n
+  int n_span;
+  head_t *lines; // iterators waiting for a later line, keyed on it
+  int n_lines;
+  uint16_t *on, *on_next; // iterators on line y, and on the next one
+  int n_on;
+  uint16_t y;
+} runs_t;
+
+static void init_runs(runs_t *r, int len) {
+  r->max = MIN_RUNS;
+  r->run = (run_t *)vgr2d_alloc(sizeof(run_t), r->max);
+  r->active = (int *)vgr2d_alloc(sizeof(int), r->max);
+  r->span = (run_t *)vgr2d_alloc(sizeof(run_t), 2 * r->max);
+  r->group = (int *)vgr2d_alloc(sizeof(int), len + 1);
+  r->pos = (int *)vgr2d_alloc(sizeof(int), len);
+  r->heap = (head_t *)vgr2d_alloc(sizeof(head_t), len);
+  r->lines = (head_t *)vgr2d_alloc(sizeof(head_t), len);
+  r->on = (uint16_t *)vgr2d_alloc(sizeof(uint16_t), len);
+  r->on_next = (uint16_t *)vgr2d_alloc(sizeof(uint16_t), len);
+  r->n_lines = 0;
+  r->n_on = 0;
+  r->n = 0;
+  r->k = 0;
+  r->n_span = 0;
+}
+
+static void grow_runs(runs_t *r) {
+  int n = r->max << 1;
+  run_t *run = (run_t *)vgr2d_alloc(sizeof(run_t), n);
+  for (int i = 0; i < r->n; i++)
+    run[i] = r->run[i];
+  // old tables stay in the arena until the end of generate
+  r->run = run;
+  r->active = (int *)vgr2d_alloc(sizeof(int), n);
+  r->span = (run_t *)vgr2d_alloc(sizeof(run_t), 2 * n);
+  r->max = n;
+}
+
+// Runs of one iterator are nearly always in order already
+static void sort_group(run_t *run, int n) {
+  int i, j;
+  run_t t;
+
+  for (i = 1; i < n; i++) {
+    t = run[i];
+    for (j = i; j > 0 && run[j-1].x1 > t.x1; j--)
+      run[j] = run[j-1];
+    run[j] = t;
+  }
+}
+
+static void heap_down(head_t *heap, int n, int i) {
+  head_t h = heap[i];
+
+  for (;;) {
+    int c = 2*i + 1;
+    if (c >= n)
+      break;
+    if (c+1 < n && heap[c+1].key < heap[c].key)
+      c++;
+    if (heap[c].key >= h.key)
+      break;
+    heap[i] = heap[c];
+    i = c;
+  }
+  heap[i] = h;
+}
+
+static void heap_up(head_t *heap, int i) {
+  head_t h = heap[i];
+
+  while (i > 0 && heap[(i-1)/2].key > h.key) {
+    heap[i] = heap[(i-1)/2];
+    i = (i-1)/2;
+  }
+  heap[i] = h;
+}
+
+static void add_span(runs_t *r, int x1, int x2, uint8_t clr) {
+  run_t *sp;
+
+  if (r->n_span > 0) {
+    sp = &r->span[r->n_span-1];
+    if (sp->clr == clr && sp->x2 + 1 >= x1) {
+      sp->x2 = x2;
+      return;
+    }
+  }
+  sp = &r->span[r->n_span++];
+  sp->x1 = x1;
+  sp->x2 = x2;
+  sp->clr = clr;
+}
+
+// Merge the groups k ways in x order, keeping only the topmost run at
+// every position, so covered parts of lower shapes are never sent.
+static void resolve_runs(runs_t *r) {
+  int g, i, j, x = 0, end, top, n_heap, n_active = 0;
+  head_t *heap = r->heap;
+
+  // shapes listed left to right with no overlap need no merge
+  for (i = 1; i < r->n && r->run[i].x1 > r->run[i-1].x2; i++)
+    ;
+  if (i == r->n) {
+    for (i = 0; i < r->n; i++)
+      add_span(r, r->run[i].x1, r->run[i].x2, r->run[i].clr);
+    return;
+  }
+
+  for (g = 0; g < r->k; g++) {
+    r->pos[g] = r->group[g];
+    heap[g].key = r->run[r->group[g]].x1;
+    heap[g].g = g;
+  }
+  n_heap = r->k;
+  for (i = n_heap/2 - 1; i >= 0; i--)
+    heap_down(heap, n_heap, i);
+
+  while (n_heap > 0 || n_active > 0) {
+    if (n_active == 0)
+      x = heap[0].key;
+
+    // open the runs starting here
+    while (n_heap > 0 && heap[0].key <= x) {
+      g = heap[0].g;
+      r->active[n_active++] = r->pos[g]++;
+      if (r->pos[g] == r->group[g+1])
+	heap[0] = heap[--n_heap];
+      else
+	heap[0].key = r->run[r->pos[g]].x1;
+      heap_down(heap, n_heap, 0);
+    }
+
+    // close the runs that ended and find the top one
+    top = -1;
+    for (i = 0, j = 0; i < n_active; i++) {
+      run_t *a = &r->run[r->active[i]];
+      if (a->x2 < x)
+	continue;
+      r->active[j++] = r->active[i];
+      if (top < 0 || a->z > r->run[top].z)
+	top = r->active[i];
+    }
+    n_active = j;
+    if (top < 0)
+      continue;
+
+    // the top run is visible until it ends or another run starts
+    end = r->run[top].x2;
+    if (n_heap > 0 && heap[0].key <= end)
+      end = heap[0].key - 1;
+    add_span(r, x, end, r->run[top].clr);
+    x = end + 1;
+  }
+}
+
+// Queue every iterator on its first line
+static void init_lines(iter_base_t **iters, int len, runs_t *r) {
+  uint16_t y;
+  int i;
+
+  r->n_lines = 0;
+  r->n_on = 0;
+  for (i = 0; i < len; i++) {
+    if (iters[i] != NULL && iters[i]->nextLine(iters[i], &y)) {
+      r->lines[r->n_lines].key = y;
+      r->lines[r->n_lines].g = i;
+      r->n_lines++;
+    }
+  }
+  for (i = r->n_lines/2 - 1; i >= 0; i--)
+    heap_down(r->lines, r->n_lines, i);
+}
+
+// Gather the runs of the next line any iterator is on. Only iterators on
+// that line are visited: the ones that went on from the previous line,
+// plus those the line heap holds for it. Returns false once every
+// iterator is done.
+static bool collect_line(iter_base_t **iters, uint16_t *curYp, runs_t *r) {
+  head_t *lines = r->lines;
+  uint16_t *on = r->on, *tmp;
+  uint16_t curY, y;
+  int i, j, k, n, start, n_next = 0;
+
+  // iterators waiting in the heap are all past the continuing ones
+  if (r->n_on > 0)
+    curY = r->y + 1;
+  else if (r->n_lines > 0)
+    curY = lines[0].key;
+  else
+    return false;
+  while (r->n_lines > 0 && lines[0].key == curY) {
+    // keep z order, so runs of shapes listed left to right stay sorted
+    for (j = r->n_on++; j > 0 && on[j-1] > lines[0].g; j--)
+      on[j] = on[j-1];
+    on[j] = lines[0].g;
+    lines[0] = lines[--r->n_lines];
+    heap_down(lines, r->n_lines, 0);
+  }
+
+  r->n = 0;
+  r->k = 0;
+  for (j = 0; j < r->n_on; j++) {
+    i = on[j];
+    start = r->n;
+    do {
+      if (r->n == r->max)
+	grow_runs(r);
+      r->n += iters[i]->nextRuns(iters[i], curY, r->run + r->n, r->max - r->n);
+    } while (r->n == r->max);
+
+    for (k = start, n = start; k < r->n; k++) {
+      if (r->run[k].x2 > r->run[k].x1) {
+	r->run[n] = r->run[k];
+	r->run[n++].z = i;
+      }
+    }
+    r->n = n;
+    if (r->n > start) {
+      sort_group(r->run + start, r->n - start);
+      r->group[r->k++] = start;
+    }
+
+    if (!iters[i]->nextLine(iters[i], &y))
+      continue;
+    if (y == curY + 1)
+      r->on_next[n_next++] = i;
+    else {
+      lines[r->n_lines].key = y;
+      lines[r->n_lines].g = i;
+      heap_up(lines, r->n_lines++);
+    }
+  }
+  tmp = r->on;
+  r->on = r->on_next;
+  r->on_next = tmp;
+  r->n_on = n_next;
+
+  r->group[r->k] = r->n;
+  r->n_span = 0;
+  if (r->n > 0)
+    resolve_runs(r);
+
+  r->y = curY;
+  *curYp = curY;
+  return true;
+}
+
+
+//////////////////////////////////////// Encode
+
+// Words needed to move x forward by dx, and to draw a span of width s
+static int skip_words(uint16_t dx) {
+  return (dx + MAX_DX - 1) / MAX_DX;
+}
+
+static int span_words(uint16_t s) {
+  return (s > MAX_CLRX) ? 1 + (s - MAX_CLRX + MAX_SPANX - 1) / MAX_SPANX : 1;
+}
+
+// Words the plain one-command-per-span encoding takes for this line,
+// what the optimized encoding is measured against.
+static int greedy_words(runs_t *r, uint16_t curY, uint16_t prevY) {
+  uint16_t curX = 0;
+  int i, n = 0;
+
+  if (curY > 0) {
+    n++;
+    if (curY == (prevY+1) && r->span[0].x1 <= MAX_NLX)
+      curX = r->span[0].x1;
+  }
+  for (i = 0; i < r->n_span; i++) {
+    run_t *sp = &r->span[i];
+    uint16_t x1 = sp->x1;
+    if (i > 0 && x1 - (r->span[i-1].x2 + 1) < MIN_DX)
+      x1 = r->span[i-1].x2 + 1;
+    if (sp->x2 - x1 < MIN_DX)
+      continue;
+    n += skip_words(x1 - curX) + span_words(sp->x2 - x1);
+    curX = sp->x2 + 1;
+  }
+  return n;
+}
+
+// Peephole pass over the visible spans of a line, in x order. All the
+// gap rules live here: a gap under MIN_DX cannot be skipped so the next
+// span is widened over it, and a span under MIN_DX cannot be drawn so it
+// is dropped, or absorbed by a same color span it touches. Touching spans
+// of one color become a single span.
+static void optimize_spans(runs_t *r) {
+  run_t *sp, *last = NULL;
+  int i, n = 0;
+
+  for (i = 0; i < r->n_span; i++) {
+    sp = &r->span[i];
+    if (last == NULL && sp->x1 < MIN_DX)
+      sp->x1 = 0; // the line start is a gap too when addressed absolutely
+    if (last != NULL && sp->x1 - (last->x2 + 1) < MIN_DX)
+      sp->x1 = last->x2 + 1;
+    if (last != NULL && sp->clr == last->clr && sp->x1 == last->x2 + 1) {
+      last->x2 = sp->x2;
+      continue;
+    }
+    if (sp->x2 - sp->x1 < MIN_DX)
+      continue;
+    last = &r->span[n++];
+    *last = *sp;
+  }
+  r->n_span = n;
+}
+
+// Skips longer than MAX_DX are split so no piece is under MIN_DX
+static void emit_skip(cmdbuf_t *out, uint16_t dx) {
+  while (dx > MAX_DX) {
+    uint16_t d = (dx - MAX_DX < MIN_DX) ? dx - MIN_DX : MAX_DX;
+    emit_cmd(out, 0x8000|d);
+    dx -= d;
+  }
+  if (dx > 0)
+    emit_cmd(out, 0x8000|dx);
+}
+
+static void emit_span(cmdbuf_t *out, run_t *sp) {
+  uint16_t s = sp->x2 - sp->x1;
+
+  if (s > MAX_CLRX) {
+    emit_cmd(out, (((uint16_t)sp->clr)<<8)|MAX_CLRX);
+    s -= MAX_CLRX;
+  } else {
+    emit_cmd(out, (((uint16_t)sp->clr)<<8)|s);
+    s = 0;
+  }
+  while (s > MAX_SPANX) {
+    emit_cmd(out, 0xc000|MAX_SPANX);
+    s -= MAX_SPANX;
+  }
+  if (s > 0)
+    emit_cmd(out, 0xc000|s);
+}
+
+// Address line curY, coming from prevY (0xffff if none), and skip to x1.
+// The next line command can also take x part of the way, leaving a skip,
+// which is never longer than an absolute line and a skip.
+static void emit_line_start(cmdbuf_t *out, uint16_t curY, uint16_t prevY, uint16_t x1) {
+  uint16_t nlx, curX;
+
+  curX = 0; // line 0 starts without a line command
+  if (curY > 0) {
+    if (curY == (prevY+1)) {
+      nlx = (x1 <= MAX_NLX) ? x1 : MAX_NLX;
+      if (x1 > nlx && x1 - nlx < MIN_DX)
+	nlx = x1 - MIN_DX;
+      emit_cmd(out, 0xa000|nlx);
+      curX = nlx;
+    } else
+      emit_cmd(out, 0xf000|curY);
+  }
+  emit_skip(out, x1 - curX);
+}
+
+// Emit one line of spans optimize_spans() has been over
+static void emit_line(cmdbuf_t *out, uint16_t curY, uint16_t prevY, runs_t *r) {
+  uint16_t curX;
+  int i;
+
+  curX = (r->n_span > 0) ? r->span[0].x1 : 0;
+  emit_line_start(out, curY, prevY, curX);
+  for (i = 0; i < r->n_span; i++) {
+    emit_skip(out, r->span[i].x1 - curX);
+    emit_span(out, &r->span[i]);
+    curX = r->span[i].x2 + 1;
+  }
+}
+
+// Encode the visible spans of one line. prevY is the line the stream is
+// on before this one, 0xffff if none. Adds the bytes saved over the plain
+// encoding to out->saved.
+static void encode_line(cmdbuf_t *out, uint16_t curY, uint16_t prevY, runs_t *r) {
+  size_t start = out->len;
+  int plain = greedy_words(r, curY, prevY);
+
+  optimize_spans(r);
+  emit_line(out, curY, prevY, r);
+  out->saved += 2 * plain - (out->len - start);
+}
+
+void vgr2d_encode(uint16_t addr, iter_base_t **iters, int len, cmdbuf_t *out) {
+  uint16_t curY, prevY;
+  runs_t r;
+
+  init_runs(&r, len);
+
+  emit_cmd(out, addr);
+
+  init_lines(iters, len, &r);
+  prevY = 0xffff;
+  while (collect_line(iters, &curY, &r)) {
+    if (r.n_span > 0) {
+      encode_line(out, curY, prevY, &r);
+      prevY = curY;
+    }
+  }
+
+  emit_cmd(out, 0xffff);
+}
+
+
+//////////////////////////////////////// Bands
+
+// Address lines [y1, y2) with no spans, clearing them.
+static void clear_lines(cmdbuf_t *out, uint16_t y1, uint16_t y2) {
+  for (uint16_t y = y1; y < y2; y++)
+    emit_cmd(out, 0xf000|y);
+}
+
+void vgr2d_encode_bands(iter_base_t **iters, int len, uint32_t dirty, cmdbuf_t *bands) {
+  uint16_t curY, next = 0, top;
+  int b, cur = -1;
+  runs_t r;
+
+  init_runs(&r, len);
+
+  for (b = 0; b < NUM_BANDS; b++)
+    if (dirty & BAND_BIT(b)) {
+      bands[b].len = 0;
+      bands[b].saved = 0;
+    }
+
+  init_lines(iters, len, &r);
+  while (collect_line(iters, &curY, &r)) {
+    b = curY / BAND_HEIGHT;
+    if (r.n_span == 0 || b >= NUM_BANDS || !(dirty & BAND_BIT(b)))
+      continue;
+    top = b * BAND_HEIGHT;
+    if (b != cur) {
+      if (cur >= 0)
+	clear_lines(&bands[cur], next, (cur+1) * BAND_HEIGHT);
+      cur = b;
+      next = top;
+    }
+    // every line of a band is addressed, so lines that emptied get cleared
+    clear_lines(&bands[b], next, curY);
+    encode_line(&bands[b], curY, (curY > top) ? curY-1 : 0xffff, &r);
+    next = curY+1;
+  }
+  if (cur >= 0)
+    clear_lines(&bands[cur], next, (cur+1) * BAND_HEIGHT);
+
+  for (b = 0; b < NUM_BANDS; b++)
+    if ((dirty & BAND_BIT(b)) && bands[b].len == 0)
+      clear_lines(&bands[b], b * BAND_HEIGHT, (b+1) * BAND_HEIGHT);
+}
+
+
+//////////////////////////////////////// Delta frames
+
+// A line is known by a hash of its visible spans, which does not depend
+// on how the line is addressed. Only lines whose hash moved are sent.
+
+#define EMPTY_HASH 0
+
+static uint32_t hash_spans(runs_t *r) {
+  uint32_t h = 2166136261u; // FNV-1a
+  int i;
+
+  for (i = 0; i < r->n_span; i++) {
+    h = (h ^ r->span[i].x1) * 16777619u;
+    h = (h ^ r->span[i].x2) * 16777619u;
+    h = (h ^ r->span[i].clr) * 16777619u;
+  }
+  return (h == EMPTY_HASH) ? 1 : h;
+}
+
+// Clear those of lines [y1, y2) that were drawn on. Returns the line the
+// stream is on after.
+static uint16_t clear_drawn(cmdbuf_t *out, uint16_t y1, uint16_t y2, uint32_t *hashes, bool valid,
+			    uint16_t prevY) {
+  for (uint16_t y = y1; y < y2; y++)
+    if (!valid || hashes[y] != EMPTY_HASH) {
+      emit_cmd(out, 0xf000|y);
+      hashes[y] = EMPTY_HASH;
+      prevY = y;
+    }
+  return prevY;
+}
+
+void vgr2d_encode_delta(uint16_t addr, iter_base_t **iters, int len, uint32_t *hashes, bool valid,
+			cmdbuf_t *out) {
+  uint16_t curY, prevY = 0xffff, next = 0;
+  uint32_t h;
+  runs_t r;
+
+  init_runs(&r, len);
+
+  emit_cmd(out, addr);
+
+  init_lines(iters, len, &r);
+  while (collect_line(iters, &curY, &r)) {
+    if (r.n_span == 0 || curY >= VIEW_HEIGHT)
+      continue;
+    prevY = clear_drawn(out, next, curY, hashes, valid, prevY);
+    next = curY+1;
+    optimize_spans(&r);
+    h = (r.n_span > 0) ? hash_spans(&r) : EMPTY_HASH;
+    if (valid && hashes[curY] == h)
+      continue;
+    hashes[curY] = h;
+    if (h == EMPTY_HASH)
+      emit_cmd(out, 0xf000|curY);
+    else
+      emit_line(out, curY, prevY, &r);
+    prevY = curY;
+  }
+  clear_drawn(out, next, VIEW_HEIGHT, hashes, valid, prevY);
+
+  emit_cmd(out, 0xffff);
+}
+
+//////////////////////////////////////// Compiled streams
+
+// Each line is kept as its words from the first span on, which only hold
+// lengths, plus where that span starts. Replay addresses every line again
+// for the origin it is given and copies the words as they are.
+
+void vgr2d_compile(iter_base_t **iters, int len, compiled_t *c) {
+  uint16_t curY, curX;
+  size_t start;
+  int i;
+  runs_t r;
+
+  init_runs(&r, len);
+
+  c->body.len = 0;
+  c->lines.len = 0;
+  c->x2 = 0;
+  c->y2 = 0;
+  init_lines(iters, len, &r);
+  while (collect_line(iters, &curY, &r)) {
+    optimize_spans(&r);
+    if (r.n_span == 0)
+      continue;
+    start = c->body.len;
+    curX = r.span[0].x1;
+    for (i = 0; i < r.n_span; i++) {
+      emit_skip(&c->body, r.span[i].x1 - curX);
+      emit_span(&c->body, &r.span[i]);
+      curX = r.span[i].x2 + 1;
+    }
+    emit_cmd(&c->lines, curY);
+    emit_cmd(&c->lines, r.span[0].x1);
+    emit_cmd(&c->lines, c->body.len - start);
+    if (r.span[r.n_span-1].x2 > c->x2)
+      c->x2 = r.span[r.n_span-1].x2;
+    c->y2 = curY;
+  }
+}
+
+static uint16_t get_word(uint8_t const *p) {
+  return (p[0] << 8) | p[1];
+}
+
+void vgr2d_replay(uint16_t addr, compiled_t const *c, uint16_t ox, uint16_t oy, cmdbuf_t *out) {
+  uint8_t const *ln = c->lines.buf, *end = ln + c->lines.len;
+  uint8_t const *body = c->body.buf;
+  uint16_t y, prevY = 0xffff;
+  size_t n;
+
+  emit_cmd(out, addr);
+  for (; ln < end; ln += 6) {
+    y = oy + get_word(ln);
+    n = get_word(ln + 4);
+    // a whole pixel origin keeps the first x at 0 or at least MIN_DX
+    emit_line_start(out, y, prevY, ox + get_word(ln + 2));
+    while (out->len + n > out->alloc)
+      vgr2d_cmd_grow(out);
+    memcpy(out->buf + out->len, body, n);
+    out->len += n;
+    body += n;
+    prevY = y;
+  }
+  emit_cmd(out, 0xffff);
+}
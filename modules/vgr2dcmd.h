@@ -0,0 +1,68 @@
+/*
+
+Copyright 2023 StreamLogic, LLC.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#ifndef VGR2DCMD_H
+#define VGR2DCMD_H
+
+// The retained scene caches its commands per band of lines
+#define BAND_HEIGHT 16
+#define NUM_BANDS ((VIEW_HEIGHT + BAND_HEIGHT - 1) / BAND_HEIGHT)
+#define BAND_BIT(b) (1ul << (b))
+
+// Packed FPGA graphics command stream, big-endian 16-bit words.
+typedef struct cmdbuf_s {
+  uint8_t *buf;
+  size_t len, alloc;
+  size_t saved; // bytes the peephole pass removed, see encode_line
+  bool fixed; // caller-supplied buffer, cannot grow
+} cmdbuf_t;
+
+// Provided by the caller: make room for at least one more command word
+// or fail without returning.
+extern void vgr2d_cmd_grow(cmdbuf_t *out);
+
+extern void vgr2d_encode(uint16_t addr, iter_base_t **iters, int len, cmdbuf_t *out);
+
+// Re-encode only the bands set in dirty, each into its own buffer of the
+// NUM_BANDS bands. Every band starts with absolute line addressing and
+// addresses all of its lines, so a band can be sent on its own to replace
+// what the FPGA holds for those lines.
+extern void vgr2d_encode_bands(iter_base_t **iters, int len, uint32_t dirty, cmdbuf_t *bands);
+
+// Encode only the lines that differ from the frame the VIEW_HEIGHT line
+// hashes were taken from, clearing lines that emptied, and update the
+// hashes. The FPGA must still hold that frame. With valid false every
+// line is sent.
+extern void vgr2d_encode_delta(uint16_t addr, iter_base_t **iters, int len, uint32_t *hashes, bool valid,
+			       cmdbuf_t *out);
+
+// A stream compiled once for replay at any origin, see vgr2d_replay
+typedef struct compiled_s {
+  cmdbuf_t body;   // the words of every line from its first span on
+  cmdbuf_t lines;  // y, first x and body bytes of every line
+  uint16_t x2, y2; // furthest x and line drawn
+} compiled_t;
+
+// Encode the shapes as they are placed for later replay. The caller sets
+// up both buffers.
+extern void vgr2d_compile(iter_base_t **iters, int len, compiled_t *c);
+
+// Emit a complete stream drawing c moved by ox (XFX, whole pixels) and oy
+// lines. The caller keeps c->x2 + ox and c->y2 + oy inside the view.
+extern void vgr2d_replay(uint16_t addr, compiled_t const *c, uint16_t ox, uint16_t oy, cmdbuf_t *out);
+
+#endif
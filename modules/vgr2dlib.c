@@ -23,6 +23,10 @@ limitations under the License.
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
 #include "vgr2dlib.h"
 
 #define ABS(a)		(((a)<0) ? -(a) : (a))
@@ -30,6 +34,7 @@ limitations under the License.
 #define UDIFF(a,b) ((a)>(b) ? (a)-(b) : 0)
 
 extern void *vgr2d_alloc(size_t size, int n);
+extern void *vgr2d_shape_alloc(size_t size, int n);
 
 
 //////////////////////////////////////// Utils
@@ -52,12 +57,70 @@ void list_minmax(uint16_t *pts, int n, uint16_t *minx_p, uint16_t *maxx_p, uint1
 }
 
 
+//////////////////////////////////////// Arena
+
+// Bump allocator for everything that lives only for one generate() call.
+// Nothing is freed individually; the whole arena is reset in one step.
+
+#define ARENA_ALIGN(n) (((n) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
+void vgr2d_arena_init(vgr2d_arena_t *arena, void *mem, size_t size) {
+  arena->mem = (uint8_t *)mem;
+  arena->size = size;
+  arena->used = 0;
+  arena->spill = 0;
+  arena->peak = 0;
+}
+
+// Returns NULL when the request does not fit, the caller must then fall
+// back to another allocator. The spilled size still counts toward peak so
+// the arena can be sized from it.
+void *vgr2d_arena_alloc(vgr2d_arena_t *arena, size_t size) {
+  void *p = NULL;
+
+  size = ARENA_ALIGN(size);
+  if (arena->used + size <= arena->size) {
+    p = arena->mem + arena->used;
+    arena->used += size;
+  } else
+    arena->spill += size;
+  if (arena->used + arena->spill > arena->peak)
+    arena->peak = arena->used + arena->spill;
+  return p;
+}
+
+void vgr2d_arena_reset(vgr2d_arena_t *arena) {
+  arena->used = 0;
+  arena->spill = 0;
+}
+
+
 //////////////////////////////////////// Edge
 
-static void fill_edges(uint16_t id, uint16_t *pts, int n, int y0, edge_t **edges) {
+static uint32_t isqrt64(uint64_t v) {
+  uint64_t r = 0, b = (uint64_t)1 << 62;
+
+  while (b > v)
+    b >>= 2;
+  while (b != 0) {
+    if (v >= r + b) {
+      v -= r + b;
+      r = (r >> 1) + b;
+    } else
+      r >>= 1;
+    b >>= 2;
+  }
+  return (uint32_t)r;
+}
+
+// Appends the edges of a closed point list to edges[n_edges...] keeping
+// the table sorted by yTop, later edges first among equal yTop. Returns
+// the new edge count.
+static int fill_edges(uint16_t *pts, int n, edge_t *edges, int n_edges) {
   int i, j;
   int X1,Y1,X2,Y2,Y3;
-  edge_t *e;
+  int32_t num;
+  edge_t *e, tmp;
 
   i=0;
   do {
@@ -80,8 +143,8 @@ static void fill_edges(uint16_t id, uint16_t *pts, int n, int y0, edge_t **edges
       if (Y2 != Y3)
 	break;
     } while (1);
-    e = (edge_t *) vgr2d_alloc(sizeof(edge_t), 1);
-    e->id = id;
+    e = &tmp;
+    e->wind = (Y2 > Y1) ? 1 : -1;
     e->xNowNumStep = ABS(X1-X2);
     if (Y2 > Y1) {
       e->yTop = Y1;
@@ -101,24 +164,89 @@ static void fill_edges(uint16_t id, uint16_t *pts, int n, int y0, edge_t **edges
       e->xNowNum = (e->xNowDen >> 1);
       if (Y3 < Y2) {
 	e->yTop++;
-	e->xNowNum += e->xNowNumStep;
-	while (e->xNowNum >= e->xNowDen) {
-	  e->xNowWhole += e->xNowDir;
-	  e->xNowNum -= e->xNowDen;
-	}
+	// num + step does not fit int16 on long flat edges
+	num = e->xNowNum + e->xNowNumStep;
+	e->xNowWhole += e->xNowDir * (num / e->xNowDen);
+	e->xNowNum = num % e->xNowDen;
       }
     }
-    e->next = edges[YFX_INT(e->yTop) - y0];
-    edges[YFX_INT(e->yTop) - y0] = e;
+    for (j = n_edges++; j > 0 && edges[j-1].yTop >= tmp.yTop; j--)
+      edges[j] = edges[j-1];
+    edges[j] = tmp;
   } while (1);
+  return n_edges;
 }
 
 
 //////////////////////////////////////// Transform
 
+// Clip a run to the viewport, false when nothing is left
+static bool clip_run(int32_t x1, int32_t x2, uint16_t *x1out, uint16_t *x2out) {
+  if (x2 < 0 || x1 > VIEW_XMAX)
+    return false;
+  *x1out = (x1 < 0) ? 0 : x1;
+  *x2out = (x2 > VIEW_XMAX) ? VIEW_XMAX : x2;
+  return true;
+}
+
+bool vgr2d_visible(bbox_t *bb) {
+  return bb->x2 >= 0 && bb->x1 <= VIEW_XMAX && bb->y2 >= 0 && bb->y1 < VIEW_HEIGHT;
+}
+
 void init_transform(transform_t *tr) {
   tr->tx = 0;
   tr->ty = 0;
+  tr->px = 0;
+  tr->py = 0;
+  tr->m[0] = XFORM_ONE;
+  tr->m[1] = 0;
+  tr->m[2] = 0;
+  tr->m[3] = XFORM_ONE;
+  tr->sx = XFORM_ONE;
+  tr->sy = XFORM_ONE;
+  tr->deg = 0;
+  tr->rev = 0;
+  tr->lrev = 0;
+}
+
+static int norm_deg(int deg);
+
+// Rotation by whole degrees, clockwise on screen as y grows downwards,
+// after scaling. Both replace the previous ones rather than compose.
+void transform_set_linear(transform_t *tr, int deg, int32_t sx, int32_t sy) {
+  int32_t c = vgr2d_cos(deg), s = vgr2d_sin(deg);
+
+  tr->deg = norm_deg(deg);
+  tr->sx = sx;
+  tr->sy = sy;
+  tr->m[0] = ((int64_t)c * sx) >> 14;
+  tr->m[1] = -(((int64_t)s * sy) >> 14);
+  tr->m[2] = ((int64_t)s * sx) >> 14;
+  tr->m[3] = ((int64_t)c * sy) >> 14;
+  tr->rev++;
+  tr->lrev++;
+}
+
+void transform_set_pivot(transform_t *tr, int32_t px, int32_t py) {
+  tr->px = px;
+  tr->py = py;
+  tr->rev++;
+  tr->lrev++;
+}
+
+bool transform_identity(transform_t *tr) {
+  return tr->m[0] == XFORM_ONE && tr->m[1] == 0 && tr->m[2] == 0 && tr->m[3] == XFORM_ONE;
+}
+
+// Linear part applied about the pivot to X in XFX units and Y in lines,
+// rounded
+static void transform_xy(transform_t *tr, int32_t X, int32_t Y, int32_t *xp, int32_t *yp) {
+  int64_t dx = X - tr->px, dy = Y - tr->py;
+  int64_t x = tr->m[0] * dx + tr->m[1] * dy * XSCALE;
+  int64_t y = tr->m[2] * dx + tr->m[3] * dy * XSCALE;
+
+  *xp = tr->px + (int32_t)((x + (XFORM_ONE>>1)) >> 16);
+  *yp = tr->py + (int32_t)((y + (XFORM_ONE*XSCALE>>1)) >> (16+XFRAC));
 }
 
 //////////////////////////////////////// Rectangle
@@ -129,283 +257,562 @@ bool rect_next_line(void *arg, uint16_t* y) {
   return (*y <= iter->y2);
 }
 
-bool rect_next_run(void *arg, uint16_t y, uint16_t* x1, uint16_t *x2, uint8_t* clr) {
+int rect_next_runs(void *arg, uint16_t y, run_t *runs, int max) {
   rect_iter_t * iter = (rect_iter_t *)arg;
-  if (iter->y == y) {
-    *x1 = iter->x1;
-    *x2 = iter->x2;
-    *clr = iter->clr;
-    iter->y += 1;
-    return true;
-  }
-  return false;
+  if (iter->y != y || max == 0)
+    return 0;
+  runs[0].x1 = iter->x1;
+  runs[0].x2 = iter->x2;
+  runs[0].clr = iter->clr;
+  iter->y += 1;
+  return 1;
 };
 
 void init_rectangle_iter(rectangle_t *rect, rect_iter_t *iter) {
   iter->base.size = sizeof(rect_iter_t);
   iter->base.nextLine = rect_next_line;
-  iter->base.nextRun = rect_next_run;
-  iter->x1 = (uint16_t)rect->tr.tx;
-  iter->x2 = iter->x1 + XFX(rect->w-1);
-  iter->y = (uint16_t)rect->tr.ty;
-  iter->y2 = iter->y + YFX(rect->h-1);
+  iter->base.nextRuns = rect_next_runs;
+  bbox_t bb;
+
+  rectangle_bounds(rect, &bb);
   iter->clr = rect->fclr;
+  if (!clip_run(bb.x1, bb.x2, &iter->x1, &iter->x2) || !vgr2d_visible(&bb)) {
+    iter->y = 1;
+    iter->y2 = 0;
+    return;
+  }
+  iter->y = (bb.y1 < 0) ? 0 : bb.y1;
+  iter->y2 = (bb.y2 >= VIEW_HEIGHT) ? VIEW_HEIGHT-1 : bb.y2;
 }
 
+// Closed outline over the same pixels as the rectangle, under the
+// rectangle's transform. Its edges are rebuilt only when the linear part
+// changes.
+polygon_t *rectangle_outline(rectangle_t *rect) {
+  polygon_t *poly = &rect->outline;
+  uint16_t *c = rect->corners;
+
+  if (poly->pts != c) {
+    c[0] = 0;
+    c[1] = 0;
+    c[2] = XFX(rect->w-1);
+    c[3] = 0;
+    c[4] = c[2];
+    c[5] = YFX(rect->h-1);
+    c[6] = 0;
+    c[7] = c[5];
+    c[8] = 0;
+    c[9] = 0;
+    poly->pts = c;
+    poly->n_pts = 10;
+    poly->fill = true;
+    poly->stroke = false;
+    poly->fclr = rect->fclr;
+    poly->width = 1;
+    poly->edges = NULL;
+    poly->xpts = NULL;
+  }
+  poly->tr = rect->tr;
+  return poly;
+}
+
+void rectangle_bounds(rectangle_t *rect, bbox_t *bb) {
+  if (!transform_identity(&rect->tr)) {
+    polygon_bounds(rectangle_outline(rect), bb);
+    return;
+  }
+  bb->x1 = rect->tr.tx;
+  bb->x2 = bb->x1 + XFX(rect->w-1);
+  bb->y1 = rect->tr.ty;
+  bb->y2 = bb->y1 + YFX(rect->h-1);
+}
 
 //////////////////////////////////////// Polygon
 
+#define EDGE_ARRAYS32 2 // x, xstep: XFX passes int16 from x = 2048 on
+#define EDGE_ARRAYS16 6
+
+// Active table arrays carved from one block, the int32 ones first.
+// Capacity stays even so every array is word aligned and the last pair
+// can be stepped whole.
+static void poly_alloc_active(poly_iter_t *iter, int n) {
+  int32_t *w = (int32_t *)vgr2d_alloc(sizeof(int32_t), (EDGE_ARRAYS32 + EDGE_ARRAYS16/2) * n);
+  int16_t *a = (int16_t *)(w + EDGE_ARRAYS32 * n);
+
+  if (iter->n_active > 0) {
+    memcpy(w + 0*n, iter->x, iter->n_active * sizeof(int32_t));
+    memcpy(w + 1*n, iter->xstep, iter->n_active * sizeof(int32_t));
+    memcpy(a + 0*n, iter->num, iter->n_active * sizeof(int16_t));
+    memcpy(a + 1*n, iter->nstep, iter->n_active * sizeof(int16_t));
+    memcpy(a + 2*n, iter->den, iter->n_active * sizeof(int16_t));
+    memcpy(a + 3*n, iter->dir, iter->n_active * sizeof(int16_t));
+    memcpy(a + 4*n, iter->ybot, iter->n_active * sizeof(int16_t));
+    memcpy(a + 5*n, iter->wind, iter->n_active * sizeof(int16_t));
+  }
+  // old tables stay in the arena until the end of generate
+  iter->x = w + 0*n;
+  iter->xstep = w + 1*n;
+  iter->num = a + 0*n;
+  iter->nstep = a + 1*n;
+  iter->den = a + 2*n;
+  iter->dir = a + 3*n;
+  iter->ybot = a + 4*n;
+  iter->wind = a + 5*n;
+  iter->max_active = n;
+}
+
+// Copy active slot i to slot j
+static void poly_move(poly_iter_t *iter, int j, int i) {
+  iter->x[j] = iter->x[i];
+  iter->num[j] = iter->num[i];
+  iter->xstep[j] = iter->xstep[i];
+  iter->nstep[j] = iter->nstep[i];
+  iter->den[j] = iter->den[i];
+  iter->dir[j] = iter->dir[i];
+  iter->ybot[j] = iter->ybot[i];
+  iter->wind[j] = iter->wind[i];
+}
+
+// Activate edge e into slot i on line y, which may be past its yTop when
+// the shape is clipped at the top.
+static void poly_activate(poly_iter_t *iter, int i, edge_t *e, int y) {
+  int32_t num = e->xNowNum + (int32_t)(y - e->yTop) * e->xNowNumStep;
+
+  iter->x[i] = e->xNowWhole + e->xNowDir * (num / e->xNowDen);
+  iter->num[i] = num % e->xNowDen;
+  iter->xstep[i] = e->xNowDir * (e->xNowNumStep / e->xNowDen);
+  iter->nstep[i] = e->xNowNumStep % e->xNowDen;
+  iter->den[i] = e->xNowDen;
+  iter->dir[i] = e->xNowDir;
+  iter->ybot[i] = e->yBot;
+  iter->wind[i] = e->wind;
+}
+
 static void poly_advance(poly_iter_t *iter, uint16_t curY) {
   int i, j;
   int subY = YFX(curY);
-  // filter out finished edges
+  // filter out finished edges, keeping their x order
   for (i = 0, j = 0; i < iter->n_active; i++) {
-    edge_t *e = iter->active[i];
-    if (e->yBot >= subY)
-      iter->active[j++] = e;
-  }
-
-  // push new edges starting
-  int idx = curY-iter->y0;
-  if (idx < iter->n_edges) {
-    edge_t *cur = iter->edges[idx];
-    while (cur != NULL && j < MAX_ACTIVE) {
-      iter->active[j++] = cur;
-      cur = cur->next;
+    if (iter->ybot[i] >= subY) {
+      if (j != i)
+	poly_move(iter, j, i);
+      j++;
     }
-    iter->idx = idx;
-  } else
-    iter->idx = iter->n_edges;
+  }
   iter->n_active = j;
+
+  // push new edges starting, skipping those that ended above a clipped top
+  while (iter->idx < iter->n_edges && YFX_INT(iter->edges[iter->idx].yTop) <= curY) {
+    edge_t *e = &iter->edges[iter->idx++];
+    if (e->yBot < subY)
+      continue;
+    if (iter->n_active == iter->max_active)
+      poly_alloc_active(iter, iter->max_active << 1);
+    poly_activate(iter, iter->n_active++, e, subY);
+  }
   iter->y = curY;
 }
 
+#if defined(__ARM_FEATURE_SIMD32)
+
+static inline int16x2_t load2(int16_t *a, int i) {
+  int16x2_t v;
+  memcpy(&v, a + i, sizeof(v));
+  return v;
+}
+
+// Step every active edge down to the next line, num two per word. SSUB16
+// sets the GE flags of the halves where num reached den, then SEL takes
+// the wrapped num and the extra dir step for just those halves. x is 32
+// bits wide, so each half of the carry is added on its own.
+static void poly_step(poly_iter_t *iter) {
+  int16x2_t num, wrap, carry;
+
+  for (int i = 0; i < iter->n_active; i += 2) {
+    num = __sadd16(load2(iter->num, i), load2(iter->nstep, i));
+    wrap = __ssub16(num, load2(iter->den, i));
+    num = __sel(wrap, num);
+    carry = __sel(load2(iter->dir, i), 0);
+    memcpy(iter->num + i, &num, sizeof(num));
+    iter->x[i] += iter->xstep[i] + (int16_t)carry;
+    iter->x[i+1] += iter->xstep[i+1] + (int16_t)(carry >> 16);
+  }
+}
+
+#else
+
+// Step every active edge down to the next line.
+static void poly_step(poly_iter_t *iter) {
+  for (int i = 0; i < iter->n_active; i++) {
+    iter->x[i] += iter->xstep[i];
+    iter->num[i] += iter->nstep[i];
+    if (iter->num[i] >= iter->den[i]) {
+      iter->num[i] -= iter->den[i];
+      iter->x[i] += iter->dir[i];
+    }
+  }
+}
+
+#endif
+
 static void poly_get_active(poly_iter_t *iter) {
-  int num_coords, i, j;
+  int i, j;
+  int32_t x;
 
   poly_advance(iter, iter->y);
-  while (iter->n_active == 0 && iter->idx < iter->n_edges) {
-    iter->y += 1;
-  }
-
-  // sort and update
-  num_coords = 0;
-  for (i = 0; i < iter->n_active; i++) {
-    edge_t *e = iter->active[i];
-    int16_t x = e->xNowWhole;
-    for (j = num_coords; j > 0 && iter->x_coords[j-1] > x; j--) {
-      iter->x_coords[j] = iter->x_coords[j-1];
-      iter->idmap[j] = iter->idmap[j-1];
-    }
-    iter->x_coords[j] = x;
-    iter->idmap[j] = e->id;
-    num_coords++;
-    e->xNowNum += e->xNowNumStep;
-    while (e->xNowNum >= e->xNowDen) {
-      e->xNowWhole += e->xNowDir;
-      e->xNowNum -= e->xNowDen;
-    }
+  while (iter->n_active == 0 && iter->idx < iter->n_edges)
+    poly_advance(iter, iter->y + 1);
+
+  // The table is still sorted from the previous line except where edges
+  // crossed or were just added, so an insertion sort is near linear. The
+  // slot past the end is free to hold the edge being placed.
+  if (iter->n_active == iter->max_active)
+    poly_alloc_active(iter, iter->max_active + 2);
+  for (i = 1; i < iter->n_active; i++) {
+    x = iter->x[i];
+    if (iter->x[i-1] <= x)
+      continue;
+    poly_move(iter, iter->n_active, i);
+    for (j = i; j > 0 && iter->x[j-1] > x; j--)
+      poly_move(iter, j, j-1);
+    poly_move(iter, j, iter->n_active);
   }
 
   iter->cur = 0;
 }
 
-static bool poly_next_line(void *arg, uint16_t* y) {
-  poly_iter_t * iter = (poly_iter_t *)arg;
-  *y = iter->ty + iter->y;
-  return (iter->n_active > 0);
+// Finish the current line and move to the next one.
+static void poly_next(poly_iter_t *iter) {
+  poly_step(iter);
+  iter->y += 1;
+  poly_get_active(iter);
 }
 
-static bool polyfill_next_run(void *arg, uint16_t yin, uint16_t* x1out, uint16_t *x2out, uint8_t* clr) {
-  uint16_t X1, X2;
-  poly_iter_t * iter = (poly_iter_t *)arg;
-  uint16_t y = yin - iter->ty;
-  
-  if (y == iter->y && iter->cur < iter->n_active) {
-    X1 = iter->x_coords[iter->cur];
-    X2 = iter->x_coords[iter->cur+1];
-    *x1out = iter->tx + X1;
-    *x2out = iter->tx + X2;
-    *clr = iter->fclr;
-    iter->cur += 2;
-    if (iter->cur >= iter->n_active) {
-      iter->y += 1;
-      poly_get_active(iter);
-    }
-    return true;
-  }
-  return false;
-};
+static void polygon_check_edges(polygon_t *poly) {
+  if (poly->edges == NULL || poly->lrev != poly->tr.lrev)
+    polygon_build_edges(poly);
+}
 
-static void init_polyfill_iter(polygon_t *poly, poly_iter_t *iter) {
-  uint16_t mnx, mxx, mny, mxy;
+// The iterator steps its own active table, leaving the shape's edges
+// untouched. Translation is only applied to the runs it returns.
+static void init_poly_active(polygon_t *poly, poly_iter_t *iter) {
+  int32_t top, bot;
 
-  iter->base.nextLine = poly_next_line;
-  iter->base.nextRun = polyfill_next_run;
-  list_minmax(poly->pts, poly->n_pts, &mnx, &mxx, &mny, &mxy);
-  iter->tx = (uint16_t)poly->tr.tx;
-  iter->ty = (uint16_t)poly->tr.ty;
-  iter->y0 = mny;
-  iter->n_edges = mxy-mny+1;
-  iter->edges = (edge_t **)vgr2d_alloc(sizeof(edge_t *), iter->n_edges);
-  for (int i = 0; i < iter->n_edges; i++)
-    iter->edges[i] = NULL;
-  fill_edges(0, poly->pts, poly->n_pts, mny, iter->edges);
+  polygon_check_edges(poly);
+  iter->tx = poly->tr.tx + poly->ox;
+  iter->ty = poly->tr.ty + poly->oy;
+
+  // visible lines in shape coordinates
+  top = (iter->ty + poly->y0 < 0) ? -iter->ty : poly->y0;
+  bot = (iter->ty + poly->y1 >= VIEW_HEIGHT) ? VIEW_HEIGHT-1 - iter->ty : poly->y1;
+  if (top > bot) {
+    top = poly->y0;
+    bot = -1;
+  }
+  iter->y_end = (bot < 0) ? 0 : bot;
+
+  iter->edges = poly->edges;
+  iter->n_edges = (bot >= 0) ? poly->n_edges : 0;
   iter->idx = 0;
   iter->n_active = 0;
-  iter->y = mny;
+  poly_alloc_active(iter, MIN_ACTIVE);
+  iter->y = top;
   poly_get_active(iter);
-  iter->width = poly->width;
   iter->fill = poly->fill;
   iter->stroke = poly->stroke;
   iter->fclr = poly->fclr;
   iter->sclr = poly->sclr;
 }
 
-static int merge_spans(poly_iter_t *iter, int endpoint, uint16_t* x1, uint16_t *x2) {
-  int i, j;
-  int n_past=0;
-  uint16_t past_ids[MAX_ACTIVE];
-  int16_t past_x[MAX_ACTIVE];
-  int16_t x;
-
-  for (i = iter->cur; i < iter->n_active; i++) {
-    for (j = 0; j < n_past; j++)
-      if (past_ids[j] == iter->idmap[i]) break;
-    if (j == n_past) {
-      // first coord
-      past_ids[n_past] = iter->idmap[i];
-      past_x[n_past] = iter->x_coords[i];
-      n_past++;
-    } else {
-      // second coord
-      x = past_x[j];
-      if (*x1 <= x && x <= *x2) {
-	// overlap
-	x = iter->x_coords[i];
-	if (x >= *x2) {
-	  // equals in condition is import to get greatest endpoint at the position
-	  *x2 = x;
-	  endpoint = i;
-	}
-      }
-    }
+static bool poly_next_line(void *arg, uint16_t* y) {
+  poly_iter_t * iter = (poly_iter_t *)arg;
+  *y = iter->ty + iter->y;
+  return (iter->n_active > 0 && iter->y <= iter->y_end);
+}
+
+static int polyfill_next_runs(void *arg, uint16_t yin, run_t *runs, int max) {
+  int32_t X1, X2;
+  poly_iter_t * iter = (poly_iter_t *)arg;
+  uint16_t y = yin - iter->ty;
+  int n = 0;
+
+  while (n < max && y == iter->y && iter->cur < iter->n_active) {
+    X1 = iter->x[iter->cur];
+    X2 = iter->x[iter->cur+1];
+    iter->cur += 2;
+    if (iter->cur >= iter->n_active)
+      poly_next(iter);
+    if (clip_run(iter->tx + X1, iter->tx + X2, &runs[n].x1, &runs[n].x2))
+      runs[n++].clr = iter->fclr;
   }
-  return endpoint;
+  return n;
+};
+
+static void init_polyfill_iter(polygon_t *poly, poly_iter_t *iter) {
+  iter->base.nextLine = poly_next_line;
+  iter->base.nextRuns = polyfill_next_runs;
+  init_poly_active(poly, iter);
 }
 
-static bool polystroke_next_run(void *arg, uint16_t yin, uint16_t* x1out, uint16_t *x2out, uint8_t* clr) {
-  uint16_t X1, X2;
+// Stroke outlines wind around their own inner joins, so runs are taken
+// with the nonzero rule: a run starts where the winding count leaves
+// zero and ends where it gets back to it.
+static int polystroke_next_runs(void *arg, uint16_t yin, run_t *runs, int max) {
+  int32_t X1, X2;
+  int w, n = 0;
   poly_iter_t * iter = (poly_iter_t *)arg;
   uint16_t y = yin - iter->ty;
-  
-  if (y == iter->y && iter->cur < iter->n_active) {
-    int cur = iter->cur;
-    uint16_t id = iter->idmap[cur];
-    X1 = iter->x_coords[cur++];
-    if (iter->idmap[cur] != id) {
-      // overlapping span, need merge
-      // find current span
-      while (cur < iter->n_active && iter->idmap[cur] != id) cur++;
-      if (cur < iter->n_active) {
-	X2 = iter->x_coords[cur];
-	cur = merge_spans(iter, cur, &X1, &X2);
-      }
-    } else
-      X2 = iter->x_coords[cur];
-    printf("%d:(%d,%d)",y,X1,X2);
-    iter->cur = cur+1;
-    if (iter->cur >= iter->n_active) {
-      printf("\n");
-      iter->y += 1;
-      poly_get_active(iter);
-    }
-    *x1out = iter->tx + X1;
-    *x2out = iter->tx + X2;
-    *clr = iter->sclr;
-    return true;
+
+  while (n < max && y == iter->y && iter->cur < iter->n_active) {
+    w = 0;
+    X1 = iter->x[iter->cur];
+    do {
+      w += iter->wind[iter->cur++];
+    } while (w != 0 && iter->cur < iter->n_active);
+    X2 = iter->x[iter->cur-1];
+    if (iter->cur >= iter->n_active)
+      poly_next(iter);
+    if (clip_run(iter->tx + X1, iter->tx + X2, &runs[n].x1, &runs[n].x2))
+      runs[n++].clr = iter->sclr;
   }
-  return false;
+  return n;
 };
 
 static void init_polystroke_iter(polygon_t *poly, poly_iter_t *iter) {
+  iter->base.nextLine = poly_next_line;
+  iter->base.nextRuns = polystroke_next_runs;
+  init_poly_active(poly, iter);
+}
+
+//////////////////////////////////////// Stroke
+
+// A stroke is one closed outline per polyline, two for a closed one,
+// offset by half the pen width on either side with a join at every
+// vertex and square caps at open ends. Outlines are worked out in XFX
+// units on both axes so the offsets are round.
+
+#define MITER_LIMIT 2 // longest miter in half widths, longer ones are beveled
+#define ROUND_DEPTH 3 // arc bisections, at most 7 points per round join
+#define JOIN_POINTS(join) (((join) == JOIN_ROUND) ? 9 : 3)
+
+typedef struct stroke_s {
+  int32_t *pts;
+  int n;
+  int32_t r; // half width
+  uint8_t join;
+} stroke_t;
+
+static void stroke_point(stroke_t *s, int32_t x, int32_t y) {
+  s->pts[s->n++] = x;
+  s->pts[s->n++] = y;
+}
+
+// Offset of length r to one side of dx, dy, the same side for any
+// direction, so walking a polyline backwards gives its other side.
+static void stroke_normal(int32_t r, int32_t dx, int32_t dy, int32_t *nx, int32_t *ny) {
+  int64_t len = isqrt64((uint64_t)((int64_t)dx * dx + (int64_t)dy * dy));
+  *nx = (int32_t)(dy * (int64_t)r / len);
+  *ny = (int32_t)(-dx * (int64_t)r / len);
+}
+
+// Points strictly between offsets a and b on the circle around x, y
+static void stroke_arc(stroke_t *s, int32_t x, int32_t y, int32_t ax, int32_t ay, int32_t bx, int32_t by, int depth) {
+  int64_t r2 = (int64_t)s->r * s->r;
+  int32_t mx = ax + bx, my = ay + by;
+
+  // stop under about 30 degrees
+  if (depth == 0 || (int64_t)ax * bx + (int64_t)ay * by >= r2 - (r2 >> 3))
+    return;
+  if (mx == 0 && my == 0) {
+    // half turn, go round the front
+    mx = -ay;
+    my = ax;
+  }
+  stroke_normal(s->r, my, -mx, &mx, &my);
+  stroke_arc(s, x, y, ax, ay, mx, my, depth - 1);
+  stroke_point(s, x + mx, y + my);
+  stroke_arc(s, x, y, mx, my, bx, by, depth - 1);
+}
+
+// Join at x, y coming in along dx, dy with offset a and leaving with b
+static void stroke_join(stroke_t *s, int32_t x, int32_t y, int32_t dx, int32_t dy, int32_t ax, int32_t ay, int32_t bx, int32_t by) {
+  int64_t r2 = (int64_t)s->r * s->r;
+  int64_t d = (int64_t)ax * bx + (int64_t)ay * by;
+
+  if (ax == bx && ay == by) {
+    stroke_point(s, x + ax, y + ay);
+  } else if ((int64_t)(bx - ax) * dx + (int64_t)(by - ay) * dy < 0) {
+    // inner side, the offset segments cross before the vertex so the
+    // outline doubles back through it
+    stroke_point(s, x + ax, y + ay);
+    stroke_point(s, x, y);
+    stroke_point(s, x + bx, y + by);
+  } else if (s->join == JOIN_MITER && 2 * r2 <= MITER_LIMIT * MITER_LIMIT * (r2 + d)) {
+    stroke_point(s, x + (int32_t)((ax + bx) * r2 / (r2 + d)), y + (int32_t)((ay + by) * r2 / (r2 + d)));
+  } else {
+    stroke_point(s, x + ax, y + ay);
+    if (s->join == JOIN_ROUND)
+      stroke_arc(s, x, y, ax, ay, bx, by, ROUND_DEPTH);
+    stroke_point(s, x + bx, y + by);
+  }
+}
+
+// One side of the polyline v[0..n-1], walked backwards when rev is set
+static void stroke_side(stroke_t *s, int32_t *v, int n, bool closed, bool rev) {
+  int32_t x, y, dx, dy, ax, ay, bx, by;
+  int k, i, j;
+
+  i = rev ? 2*(n-1) : 0;
+  j = rev ? 2*(n-2) : 2;
+  if (closed) {
+    k = rev ? 0 : 2*(n-1);
+    dx = v[i] - v[k];
+    dy = v[i+1] - v[k+1];
+  } else {
+    dx = v[j] - v[i];
+    dy = v[j+1] - v[i+1];
+  }
+  stroke_normal(s->r, dx, dy, &ax, &ay);
+  if (!closed) {
+    // square cap, ay, -ax is back along the segment
+    stroke_point(s, v[i] + ax + ay, v[i+1] + ay - ax);
+  }
+  for (k = closed ? 0 : 1; k < (closed ? n : n-1); k++) {
+    i = 2 * (rev ? n-1-k : k);
+    j = 2 * (rev ? (n-2-k+n) % n : (k+1) % n);
+    x = v[i];
+    y = v[i+1];
+    stroke_normal(s->r, v[j] - x, v[j+1] - y, &bx, &by);
+    stroke_join(s, x, y, dx, dy, ax, ay, bx, by);
+    dx = v[j] - x;
+    dy = v[j+1] - y;
+    ax = bx;
+    ay = by;
+  }
+  if (!closed) {
+    i = rev ? 0 : 2*(n-1);
+    stroke_point(s, v[i] + ax - ay, v[i+1] + ay + ax);
+  }
+}
+
+// Repeat the first point of the loop starting at pts[start]
+static void stroke_close(stroke_t *s, int start) {
+  stroke_point(s, s->pts[start], s->pts[start+1]);
+}
+
+// Upper bound on outline points, which also bounds the edges
+static int stroke_capacity(polygon_t *poly) {
+  return 2 * ((poly->n_pts>>1) + 1) * JOIN_POINTS(poly->join) + 4;
+}
+
+// Builds the outline of the polyline and fills edges from it. The
+// outline is shifted to stay unsigned, the shift goes to ox, oy.
+static int stroke_edges(polygon_t *poly, uint16_t *line, edge_t *edges) {
+  int cap = stroke_capacity(poly);
+  int32_t *v = (int32_t *)vgr2d_alloc(sizeof(int32_t), poly->n_pts + 2);
+  uint16_t *out;
+  int32_t mnx = INT32_MAX, mny = INT32_MAX;
+  int i, n = 0, loop2 = 0, n_edges;
+  bool closed;
+  stroke_t s;
+
+  // vertices in XFX units on both axes, without repeats
+  for (i = 0; i < poly->n_pts; i += 2) {
+    int32_t x = line[i], y = XFX((int32_t)line[i+1]);
+    if (n > 0 && v[n-2] == x && v[n-1] == y)
+      continue;
+    v[n++] = x;
+    v[n++] = y;
+  }
+  n >>= 1;
+  closed = (n > 3 && v[0] == v[2*n-2] && v[1] == v[2*n-1]);
+  if (closed)
+    n--;
+  else if (n == 1) {
+    // a single point, draw a pen sized dot
+    v[2] = v[0] + 1;
+    v[3] = v[1];
+    n = 2;
+  }
+
+  s.pts = (int32_t *)vgr2d_alloc(sizeof(int32_t), 2 * cap);
+  s.n = 0;
+  s.r = XFX((poly->width >= 3) ? poly->width : 3) >> 1;
+  s.join = poly->join;
+  stroke_side(&s, v, n, closed, false);
+  if (closed) {
+    stroke_close(&s, 0);
+    loop2 = s.n;
+  }
+  stroke_side(&s, v, n, closed, true);
+  stroke_close(&s, loop2);
+
+  // back to lines, shifted to stay unsigned
+  for (i = 0; i < s.n; i += 2) {
+    s.pts[i+1] = (s.pts[i+1] + (XSCALE>>1)) >> XFRAC;
+    if (s.pts[i] < mnx) mnx = s.pts[i];
+    if (s.pts[i+1] < mny) mny = s.pts[i+1];
+  }
+  out = (uint16_t *)vgr2d_alloc(sizeof(uint16_t), s.n);
+  for (i = 0; i < s.n; i += 2) {
+    out[i] = s.pts[i] - mnx;
+    out[i+1] = s.pts[i+1] - mny;
+  }
+  poly->ox += mnx;
+  poly->oy += mny;
+  list_minmax(out, s.n, &poly->x0, &poly->x1, &poly->y0, &poly->y1);
+  if (loop2 == 0)
+    return fill_edges(out, s.n, edges, 0);
+  n_edges = fill_edges(out, loop2, edges, 0);
+  return fill_edges(out + loop2, s.n - loop2, edges, n_edges);
+}
+
+// Put the points through the linear part of the transform, shifted so
+// they stay unsigned; ox, oy give the shift back.
+static uint16_t *transform_points(polygon_t *poly) {
+  int32_t x, y, mnx = INT32_MAX, mny = INT32_MAX;
   int i;
-  uint16_t xr, yr;
-  uint16_t mnx, mxx, mny, mxy;
-  int X1,Y1,X2,Y2,dx,dy;
-  uint16_t pts[14];
 
-  iter->base.nextLine = poly_next_line;
-  iter->base.nextRun = polystroke_next_run;
-  xr = (poly->width >= 3) ? XFX(poly->width)>>1 : XFX(3)>>1;
-  yr = (poly->width >= 3) ? (YFX(poly->width)-1)>>1 : 1;
-  list_minmax(poly->pts, poly->n_pts, &mnx, &mxx, &mny, &mxy);
-  mnx -= xr;
-  mxx += xr;
-  mny -= yr;
-  mxy += yr;
-  iter->tx = (uint16_t)poly->tr.tx;
-  iter->ty = (uint16_t)poly->tr.ty;
-  iter->y0 = mny;
-  iter->n_edges = mxy-mny+1;
-  iter->edges = (edge_t **)vgr2d_alloc(sizeof(edge_t *), iter->n_edges);
-  for (i = 0; i < iter->n_edges; i++)
-    iter->edges[i] = NULL;
-  for (i = 2; i < poly->n_pts; i += 2) {
-    X1 = poly->pts[i-2];
-    Y1 = poly->pts[i-1];
-    X2 = poly->pts[i];
-    Y2 = poly->pts[i+1];
-    dx = X2-X1;
-    dy = Y2-Y1;
-    if (dx < 0) {
-      X2 = X1;
-      Y2 = Y1;
-      X1 = poly->pts[i];
-      Y1 = poly->pts[i+1];
-    }
-    if (SIGN(dx) == SIGN(dy)) {
-      // SE, NW swapped
-      pts[0] = X1+xr;
-      pts[1] = UDIFF(Y1,yr);
-      pts[2] = UDIFF(X1,xr);
-      pts[3] = pts[1];
-      pts[4] = pts[2];
-      pts[5] = Y1+yr;
-      pts[6] = UDIFF(X2,xr);
-      pts[7] = Y2+yr;
-      pts[8] = X2+xr;
-      pts[9] = pts[7];
-      pts[10] = pts[8];
-      pts[11] = UDIFF(Y2,yr);
-    } else {
-      // NE, SW swapped
-      pts[0] = UDIFF(X1, xr);
-      pts[1] = UDIFF(Y1, yr);
-      pts[2] = pts[0];
-      pts[3] = Y1+yr;
-      pts[4] = X1+xr;
-      pts[5] = pts[3];
-      pts[6] = X2+xr;
-      pts[7] = Y2+yr;
-      pts[8] = pts[6];
-      pts[9] = UDIFF(Y2, yr);
-      pts[10] = UDIFF(X2, xr);
-      pts[11] = pts[9];
-    }
-    pts[12] = pts[0];
-    pts[13] = pts[1];
-    fill_edges(i>>1, pts, 14, mny, iter->edges);
+  for (i = 0; i < poly->n_pts; i += 2) {
+    transform_xy(&poly->tr, poly->pts[i], poly->pts[i+1], &x, &y);
+    if (x < mnx) mnx = x;
+    if (y < mny) mny = y;
+  }
+  if (poly->xpts == NULL)
+    poly->xpts = (uint16_t *)vgr2d_shape_alloc(sizeof(uint16_t), poly->n_pts);
+  for (i = 0; i < poly->n_pts; i += 2) {
+    transform_xy(&poly->tr, poly->pts[i], poly->pts[i+1], &x, &y);
+    poly->xpts[i] = x - mnx;
+    poly->xpts[i+1] = y - mny;
+  }
+  poly->ox = mnx;
+  poly->oy = mny;
+  return poly->xpts;
+}
+
+// Build the edge table once per shape, in shape coordinates. Moving the
+// shape only changes its transform, so the table is reused every frame;
+// rotating or scaling it rebuilds the table in place.
+void polygon_build_edges(polygon_t *poly) {
+  uint16_t *pts = poly->pts;
+
+  poly->ox = 0;
+  poly->oy = 0;
+  if (!transform_identity(&poly->tr))
+    pts = transform_points(poly);
+  poly->lrev = poly->tr.lrev;
+
+  if (poly->fill) {
+    // at most one edge per point pair
+    if (poly->edges == NULL)
+      poly->edges = (edge_t *)vgr2d_shape_alloc(sizeof(edge_t), poly->n_pts>>1);
+    list_minmax(pts, poly->n_pts, &poly->x0, &poly->x1, &poly->y0, &poly->y1);
+    poly->n_edges = fill_edges(pts, poly->n_pts, poly->edges, 0);
+  } else {
+    if (poly->edges == NULL)
+      poly->edges = (edge_t *)vgr2d_shape_alloc(sizeof(edge_t), stroke_capacity(poly));
+    poly->n_edges = stroke_edges(poly, pts, poly->edges);
   }
-  iter->idx = 0;
-  iter->n_active = 0;
-  iter->y = mny;
-  poly_get_active(iter);
-  iter->width = poly->width;
-  iter->fill = poly->fill;
-  iter->stroke = poly->stroke;
-  iter->fclr = poly->fclr;
-  iter->sclr = poly->sclr;
 }
 
 void init_polygon_iter(polygon_t *poly, poly_iter_t *iter) {
@@ -415,3 +822,481 @@ void init_polygon_iter(polygon_t *poly, poly_iter_t *iter) {
   else
     init_polystroke_iter(poly, iter);
 }
+
+void polygon_bounds(polygon_t *poly, bbox_t *bb) {
+  polygon_check_edges(poly);
+  bb->x1 = poly->tr.tx + poly->ox + poly->x0;
+  bb->x2 = poly->tr.tx + poly->ox + poly->x1;
+  bb->y1 = poly->tr.ty + poly->oy + poly->y0;
+  bb->y2 = poly->tr.ty + poly->oy + poly->y1;
+}
+
+
+//////////////////////////////////////// Trig
+
+// sin of whole degrees for a quarter turn, scaled by TRIG_ONE
+static const int16_t sin_deg[91] = {
+  0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+  2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+  5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+  8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+  10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+  12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+  14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+  15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+  16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+  16384
+};
+
+static int norm_deg(int deg) {
+  deg %= 360;
+  return (deg < 0) ? deg + 360 : deg;
+}
+
+int vgr2d_sin(int deg) {
+  deg = norm_deg(deg);
+  if (deg <= 90) return sin_deg[deg];
+  if (deg <= 180) return sin_deg[180 - deg];
+  if (deg <= 270) return -sin_deg[deg - 180];
+  return -sin_deg[360 - deg];
+}
+
+int vgr2d_cos(int deg) {
+  return vgr2d_sin(deg + 90);
+}
+
+
+//////////////////////////////////////// Ellipse
+
+// Ellipses and arcs are traced a line at a time from the implicit form
+// x^2*RY^2 + dy^2*RX^2 <= RX^2*RY^2, updated incrementally as x and dy
+// change, so there are no edges to allocate or merge. x is in XFX units.
+// Using RY^2+RY for RY^2 rounds the top and bottom lines outwards.
+
+#define ARC_INF 0x100000
+
+// Place a boundary on line dy relative to the center
+static void track_start(ell_track_t *t, int32_t dy) {
+  t->dy = dy;
+  if (dy < -t->ry || dy > t->ry)
+    t->x = -1;
+  else {
+    t->x = isqrt64((uint64_t)(t->a * (t->b - (int64_t)dy * dy) / t->b));
+    t->f = (int64_t)t->x * t->x * t->b + (int64_t)dy * dy * t->a - t->a * t->b;
+  }
+}
+
+static void track_init(ell_track_t *t, int32_t rx, int32_t ry, int32_t dy) {
+  t->a = (int64_t)rx * rx;
+  t->b = (int64_t)ry * ry + ry;
+  t->ry = ry;
+  track_start(t, dy);
+}
+
+static void track_step(ell_track_t *t) {
+  int32_t dy = t->dy + 1;
+
+  if (t->x < 0 || dy > t->ry) {
+    track_start(t, dy);
+    return;
+  }
+  t->dy = dy;
+  t->f += (int64_t)(2*dy - 1) * t->a;
+  if (dy <= 0) {
+    // widening towards the center
+    while (t->f + (int64_t)(2*t->x + 1) * t->b <= 0) {
+      t->f += (int64_t)(2*t->x + 1) * t->b;
+      t->x++;
+    }
+  } else {
+    // narrowing past it
+    while (t->f > 0 && t->x > 0) {
+      t->f -= (int64_t)(2*t->x - 1) * t->b;
+      t->x--;
+    }
+  }
+}
+
+// The iterator only draws axis-aligned ellipses. Scaling applies to the
+// radii and rotation turns the arc, swapping the radii a quarter turn
+// round; in between the axes stay put, which is exact for circles.
+static void ellipse_axes(ellipse_t *ell, int32_t *rx, int32_t *ry) {
+  int32_t a = ((int64_t)ell->rx * ell->tr.sx + (XFORM_ONE>>1)) >> 16;
+  int32_t b = ((int64_t)ell->ry * ell->tr.sy + (XFORM_ONE>>1)) >> 16;
+
+  if (a < 1) a = 1;
+  if (b < 1) b = 1;
+  if (ell->tr.deg == 90 || ell->tr.deg == 270) {
+    *rx = b;
+    *ry = a;
+  } else {
+    *rx = a;
+    *ry = b;
+  }
+}
+
+// The center only moves when the pivot is off it
+static void ellipse_center(ellipse_t *ell, int32_t *cx, int32_t *cy) {
+  transform_xy(&ell->tr, 0, 0, cx, cy);
+  *cx += ell->tr.tx;
+  *cy += ell->tr.ty;
+}
+
+// Outer boundary, and inner one for a stroke, XFX and lines. Returns
+// false when the stroke is too wide for a hole.
+static bool ellipse_radii(ellipse_t *ell, int32_t *xo, int32_t *yo, int32_t *xi, int32_t *yi) {
+  int32_t rx, ry;
+
+  ellipse_axes(ell, &rx, &ry);
+  rx = XFX(rx);
+  ry = YFX(ry);
+
+  if (ell->fill) {
+    *xo = rx;
+    *yo = ry;
+    return false;
+  }
+  *xo = rx + (XFX(ell->width)>>1);
+  *xi = rx - (XFX(ell->width)>>1);
+  *yo = ry + (YFX(ell->width)>>1);
+  *yi = *yo - YFX(ell->width);
+  return (*xi > 0 && *yi > 0);
+}
+
+static bool arc_has(ellipse_iter_t *iter, int deg) {
+  return (iter->start <= deg && deg <= iter->end) ||
+    (iter->start <= deg+360 && deg+360 <= iter->end);
+}
+
+// XFX x per line along a ray, 8.8, unused for horizontal rays
+static int32_t ray_slope(int deg) {
+  int32_t s = vgr2d_sin(deg);
+  return (s == 0) ? 0 : (XFX(1) * 256 * vgr2d_cos(deg)) / s;
+}
+
+// x on line dy of the ray at deg, one of the arc ends or a multiple of 180
+static int32_t ray_x(ellipse_iter_t *iter, int deg, int32_t dy) {
+  if (deg % 180 == 0)
+    return (deg % 360 == 0) ? ARC_INF : -ARC_INF;
+  return (dy * ((norm_deg(deg) == iter->start) ? iter->k0 : iter->k1)) >> 8;
+}
+
+// Intervals of x, relative to the center, within the arc's angles on line
+// dy, in x order. Angles grow clockwise, so along a line below the center
+// they run from 0 at +x to 180 at -x, and above it from 180 to 360.
+static int arc_spans(ellipse_iter_t *iter, int32_t dy, int32_t *lo, int32_t *hi) {
+  int k, n = 0, h0, h1, p, q;
+  int32_t t;
+
+  if (dy == 0) {
+    if (arc_has(iter, 180)) {
+      lo[n] = -ARC_INF;
+      hi[n++] = 0;
+    }
+    if (arc_has(iter, 0)) {
+      lo[n] = 0;
+      hi[n++] = ARC_INF;
+    }
+    return n;
+  }
+  h0 = (dy > 0) ? 0 : 180;
+  h1 = h0 + 180;
+  for (k = 0; k < 2; k++) {
+    p = iter->start - 360*k;
+    q = iter->end - 360*k;
+    if (p < h0) p = h0;
+    if (q > h1) q = h1;
+    if (p >= q)
+      continue;
+    if (dy > 0) {
+      lo[n] = ray_x(iter, q, dy);
+      hi[n] = ray_x(iter, p, dy);
+    } else {
+      lo[n] = ray_x(iter, p, dy);
+      hi[n] = ray_x(iter, q, dy);
+    }
+    n++;
+  }
+  if (n == 2 && lo[1] < lo[0]) {
+    t = lo[0]; lo[0] = lo[1]; lo[1] = t;
+    t = hi[0]; hi[0] = hi[1]; hi[1] = t;
+  }
+  return n;
+}
+
+// Runs of the current line: the disc or the two sides of the ring, cut
+// to the arc
+static void ellipse_line(ellipse_iter_t *iter) {
+  int32_t rlo[2], rhi[2], slo[2], shi[2], lo, hi;
+  int32_t xo = iter->outer.x, xi = iter->ring ? iter->inner.x : -1;
+  int nr = 0, ns = 1, i, j;
+
+  if (xo >= 0) {
+    if (xi < 0) {
+      rlo[0] = -xo;
+      rhi[0] = xo;
+      nr = 1;
+    } else {
+      rlo[0] = -xo;
+      rhi[0] = -xi;
+      rlo[1] = xi;
+      rhi[1] = xo;
+      nr = 2;
+    }
+  }
+  slo[0] = -ARC_INF;
+  shi[0] = ARC_INF;
+  if (iter->arc)
+    ns = arc_spans(iter, iter->outer.dy, slo, shi);
+
+  iter->n_runs = 0;
+  iter->cur = 0;
+  for (i = 0; i < nr; i++) {
+    for (j = 0; j < ns; j++) {
+      lo = iter->cx + ((rlo[i] > slo[j]) ? rlo[i] : slo[j]);
+      hi = iter->cx + ((rhi[i] < shi[j]) ? rhi[i] : shi[j]);
+      if (hi <= lo || !clip_run(lo, hi, &iter->runs[2*iter->n_runs], &iter->runs[2*iter->n_runs+1]))
+	continue;
+      iter->n_runs++;
+    }
+  }
+}
+
+// Move to the next line with runs on it
+static void ellipse_next(ellipse_iter_t *iter) {
+  do {
+    iter->y++;
+    track_step(&iter->outer);
+    if (iter->ring)
+      track_step(&iter->inner);
+    ellipse_line(iter);
+  } while (iter->n_runs == 0 && iter->y <= iter->y2);
+}
+
+static bool ellipse_next_line(void *arg, uint16_t* y) {
+  ellipse_iter_t * iter = (ellipse_iter_t *)arg;
+  *y = iter->y;
+  return (iter->y <= iter->y2);
+}
+
+static int ellipse_next_runs(void *arg, uint16_t y, run_t *runs, int max) {
+  ellipse_iter_t * iter = (ellipse_iter_t *)arg;
+  int n = 0;
+
+  if (y != iter->y)
+    return 0;
+  while (n < max && iter->cur < iter->n_runs) {
+    runs[n].x1 = iter->runs[2*iter->cur];
+    runs[n].x2 = iter->runs[2*iter->cur+1];
+    runs[n++].clr = iter->clr;
+    iter->cur++;
+  }
+  if (iter->cur == iter->n_runs)
+    ellipse_next(iter);
+  return n;
+}
+
+void init_ellipse_iter(ellipse_t *ell, ellipse_iter_t *iter) {
+  int32_t xo, yo, xi = 0, yi = 0, cy, dy;
+
+  iter->base.size = sizeof(ellipse_iter_t);
+  iter->base.nextLine = ellipse_next_line;
+  iter->base.nextRuns = ellipse_next_runs;
+  iter->ring = ellipse_radii(ell, &xo, &yo, &xi, &yi);
+  iter->clr = ell->fill ? ell->fclr : ell->sclr;
+
+  iter->arc = (ell->sweep > 0 && ell->sweep < 360);
+  if (iter->arc) {
+    iter->start = norm_deg(ell->start + ell->tr.deg);
+    iter->end = iter->start + ell->sweep;
+    iter->k0 = ray_slope(iter->start);
+    iter->k1 = ray_slope(iter->end);
+  }
+
+  // start on the first line that is on screen
+  ellipse_center(ell, &iter->cx, &cy);
+  dy = (cy < yo) ? -cy : -yo;
+  iter->y = cy + dy;
+  iter->y2 = (cy + yo >= VIEW_HEIGHT) ? VIEW_HEIGHT-1 : cy + yo;
+  track_init(&iter->outer, xo, yo, dy);
+  if (iter->ring)
+    track_init(&iter->inner, xi, yi, dy);
+  ellipse_line(iter);
+  if (iter->n_runs == 0 && iter->y <= iter->y2)
+    ellipse_next(iter);
+}
+
+void ellipse_bounds(ellipse_t *ell, bbox_t *bb) {
+  int32_t xo, yo, xi, yi, cx, cy;
+
+  ellipse_radii(ell, &xo, &yo, &xi, &yi);
+  ellipse_center(ell, &cx, &cy);
+  bb->x1 = cx - xo;
+  bb->x2 = cx + xo;
+  bb->y1 = cy - yo;
+  bb->y2 = cy + yo;
+}
+
+
+//////////////////////////////////////// Bitmap
+
+// Rows are packed MSB first and padded to a byte
+static int bitmap_pixel(const uint8_t *row, int x, int bpp) {
+  int bit = x * bpp;
+  return (row[bit >> 3] >> (8 - bpp - (bit & 7))) & ((1 << bpp) - 1);
+}
+
+// Run-length encode w x h pixels of data into the shape's run table,
+// clr[v-1] being the colour of pixel value v. Returns the number of runs.
+int bitmap_encode(bitmap_t *bmp, const uint8_t *data, int bpp, const uint8_t *clr) {
+  int stride = (bmp->w * bpp + 7) >> 3;
+  int pass, x, y, v, x1, n = 0;
+
+  // count, then fill
+  for (pass = 0; pass < 2; pass++) {
+    n = 0;
+    for (y = 0; y < bmp->h; y++) {
+      const uint8_t *row = data + y * stride;
+      if (pass)
+	bmp->rows[y] = n;
+      for (x = 0; x < bmp->w; ) {
+	v = bitmap_pixel(row, x, bpp);
+	for (x1 = x++; x < bmp->w && bitmap_pixel(row, x, bpp) == v; x++)
+	  ;
+	if (v == 0)
+	  continue;
+	if (pass) {
+	  bmp->runs[n].x1 = x1;
+	  bmp->runs[n].x2 = x - 1;
+	  bmp->runs[n].clr = clr[v-1];
+	}
+	n++;
+      }
+    }
+    if (!pass) {
+      bmp->runs = (run_t *)vgr2d_shape_alloc(sizeof(run_t), (n > 0) ? n : 1);
+      bmp->rows = (uint16_t *)vgr2d_shape_alloc(sizeof(uint16_t), bmp->h + 1);
+    }
+  }
+  bmp->rows[bmp->h] = n;
+  return n;
+}
+
+// Move to the next row with runs on it
+static void bitmap_skip_empty(bitmap_iter_t *iter) {
+  uint16_t *rows = iter->bmp->rows;
+
+  while (iter->y <= iter->y_end && rows[iter->y] == rows[iter->y+1])
+    iter->y++;
+  if (iter->y <= iter->y_end)
+    iter->cur = rows[iter->y];
+}
+
+static bool bitmap_next_line(void *arg, uint16_t* y) {
+  bitmap_iter_t * iter = (bitmap_iter_t *)arg;
+  *y = iter->ty + iter->y;
+  return (iter->y <= iter->y_end);
+}
+
+static int bitmap_next_runs(void *arg, uint16_t y, run_t *runs, int max) {
+  bitmap_iter_t * iter = (bitmap_iter_t *)arg;
+  bitmap_t *bmp = iter->bmp;
+  run_t *r;
+  int n = 0;
+
+  if (y != iter->ty + iter->y)
+    return 0;
+  while (n < max && iter->cur < bmp->rows[iter->y+1]) {
+    r = &bmp->runs[iter->cur++];
+    // pixels x1..x2 cover x1*16 up to just before (x2+1)*16
+    if (clip_run(iter->tx + XFX((int32_t)r->x1), iter->tx + XFX((int32_t)r->x2 + 1) - 1,
+		 &runs[n].x1, &runs[n].x2))
+      runs[n++].clr = r->clr;
+  }
+  if (iter->cur == bmp->rows[iter->y+1]) {
+    iter->y++;
+    bitmap_skip_empty(iter);
+  }
+  return n;
+}
+
+void init_bitmap_iter(bitmap_t *bmp, bitmap_iter_t *iter) {
+  iter->base.size = sizeof(bitmap_iter_t);
+  iter->base.nextLine = bitmap_next_line;
+  iter->base.nextRuns = bitmap_next_runs;
+  iter->bmp = bmp;
+  iter->tx = bmp->tr.tx;
+  iter->ty = bmp->tr.ty;
+  iter->y = (iter->ty < 0) ? -iter->ty : 0;
+  iter->y_end = (iter->ty + bmp->h > VIEW_HEIGHT) ? VIEW_HEIGHT-1 - iter->ty : bmp->h-1;
+  bitmap_skip_empty(iter);
+}
+
+void bitmap_bounds(bitmap_t *bmp, bbox_t *bb) {
+  bb->x1 = bmp->tr.tx;
+  bb->x2 = bb->x1 + XFX(bmp->w) - 1;
+  bb->y1 = bmp->tr.ty;
+  bb->y2 = bb->y1 + YFX(bmp->h-1);
+}
+
+
+//////////////////////////////////////// Text
+
+#define GLYPH_GAP 2 // pixels between glyphs, as display.text leaves
+
+// txt2cfont -s fonts hold the height, then for each of ' '..'~' its
+// width, height+1 row offsets counted from the end of those and the
+// (start, length) pairs of the runs of each row. The index points at the
+// width of each glyph. Other characters are drawn as spaces.
+static uint8_t const *font_glyph(text_t const *text, char c, int *w) {
+  uint8_t const *f;
+
+  if (c < ' ' || c > '~')
+    c = ' ';
+  f = text->font + text->index[c - ' '];
+  *w = f[0];
+  return f + 1;
+}
+
+// Copy the glyph runs of the rows of s into the text's bitmap, so later
+// frames reuse the runs. The run table only grows, so changing the string
+// of a label rarely allocates. Returns the number of runs.
+int text_encode(text_t *text, char const *s, size_t len) {
+  bitmap_t *bmp = &text->bmp;
+  uint8_t const *g, *span;
+  int pass, k, x0 = 0, y, w, n = 0;
+  size_t i;
+
+  bmp->h = text->font[0];
+  for (pass = 0; pass < 2; pass++) {
+    n = 0;
+    for (y = 0; y < bmp->h; y++) {
+      if (pass)
+	bmp->rows[y] = n;
+      for (i = 0, x0 = 0; i < len; i++, x0 += w + GLYPH_GAP) {
+	g = font_glyph(text, s[i], &w);
+	span = g + bmp->h + 1;
+	if (pass) {
+	  for (k = g[y]; k < g[y + 1]; k += 2, n++) {
+	    bmp->runs[n].x1 = x0 + span[k];
+	    bmp->runs[n].x2 = x0 + span[k] + span[k + 1] - 1;
+	    bmp->runs[n].clr = text->clr;
+	  }
+	} else {
+	  n += (g[y + 1] - g[y]) / 2;
+	}
+      }
+    }
+    if (!pass) {
+      bmp->w = (len > 0) ? x0 - GLYPH_GAP : 1;
+      if (n > text->cap || bmp->runs == NULL) {
+	text->cap = (n > 0) ? n : 1;
+	bmp->runs = (run_t *)vgr2d_shape_alloc(sizeof(run_t), text->cap);
+      }
+      if (bmp->rows == NULL)
+	bmp->rows = (uint16_t *)vgr2d_shape_alloc(sizeof(uint16_t), bmp->h + 1);
+    }
+  }
+  bmp->rows[bmp->h] = n;
+  return n;
+}
@@ -28,35 +28,75 @@ limitations under the License.
 #define XSCALE (1<<4)
 #define YSCALE 1
 
-#define MAX_ACTIVE 8
+#define MIN_ACTIVE 8
 
+// vgr2d_sin/vgr2d_cos scale
+#define TRIG_ONE (1<<14)
+
+// Transform scale factors and matrix entries
+#define XFORM_ONE (1<<16)
+
+// Stroke joins
+#define JOIN_MITER 0
+#define JOIN_BEVEL 1
+#define JOIN_ROUND 2
+
+// Graphics overlay size in pixels
+#define VIEW_WIDTH 640
+#define VIEW_HEIGHT 400
+// Runs are clipped to [0, VIEW_XMAX], lines to [0, VIEW_HEIGHT)
+#define VIEW_XMAX XFX(VIEW_WIDTH-1)
+
+
+typedef struct vgr2d_arena_s {
+  uint8_t *mem;
+  size_t size, used;
+  size_t spill; // bytes requested past the end of mem
+  size_t peak;  // high-water mark of used+spill
+} vgr2d_arena_t;
+
+// A run of one line, x in XFX units
+typedef struct run_s {
+  uint16_t x1, x2;
+  uint16_t z; // iterator index, set by the encoder
+  uint8_t clr;
+} run_t;
 
 typedef struct iter_base_s {
   size_t size;
   bool (*nextLine)(void *, uint16_t*);
-  bool (*nextRun)(void *, uint16_t, uint16_t*, uint16_t*, uint8_t*);
+  // Store up to max runs of line y, returning how many. A full array
+  // means the line may have more.
+  int (*nextRuns)(void *, uint16_t, run_t*, int);
 } iter_base_t;
 
+// An edge as built for the shape, at its top line. Iterators load it into
+// their active table when they reach it.
 typedef struct edge {
-  struct edge *next;
-  uint16_t id;
+  int16_t wind; // +1 when the outline runs down the edge, -1 up
   int16_t yTop, yBot;
-  int16_t xNowWhole, xNowNum, xNowDen, xNowDir;
-  int16_t xNowNumStep;
+  int16_t xNowNum, xNowDen, xNowDir;
+  int32_t xNowWhole, xNowNumStep; // XFX, past int16 from x = 2048 on
 } edge_t;
 
+// Points are scaled and rotated clockwise about the pivot, then moved by
+// tx, ty.
 typedef struct transform_s {
-  float tx;
-  float ty;
+  int32_t tx;      // XFX units
+  int32_t ty;      // lines
+  int32_t px, py;  // pivot in shape coordinates, XFX units and lines
+  int32_t m[4];    // linear part in pixels, x' = m0*x + m1*y, y' = m2*x + m3*y
+  int32_t sx, sy;  // scale, XFORM_ONE is 1
+  int16_t deg;     // rotation, 0..359
+  uint16_t rev;    // bumped on every change to the shape
+  uint16_t lrev;   // bumped on every change to the linear part
 } transform_t;
 
+// Shape extent, x in XFX units and y in lines, both inclusive
+typedef struct bbox_s {
+  int x1, y1, x2, y2;
+} bbox_t;
 
-typedef struct rectangle_s {
-  transform_t tr;
-  bool fill, stroke;
-  uint8_t fclr,sclr;
-  uint16_t w, h;
-} rectangle_t;
 
 typedef struct rect_iter_s {
   iter_base_t base;
@@ -72,25 +112,124 @@ typedef struct polygon_s {
   uint8_t fclr,sclr;
   uint16_t *pts;
   int n_pts, width;
+  uint8_t join; // JOIN_*, for strokes
+  edge_t *edges; // outline in shape coordinates, sorted by yTop
+  int n_edges;
+  uint16_t lrev; // tr.lrev the edges were built for
+  uint16_t *xpts; // pts through the linear part, when it is not identity
+  int32_t ox, oy; // where xpts 0,0 lands relative to the shape origin
+  uint16_t x0, y0, x1, y1; // outline extent
 } polygon_t;
 
+// Drawn as its outline polygon once rotated or scaled
+typedef struct rectangle_s {
+  transform_t tr;
+  bool fill, stroke;
+  uint8_t fclr,sclr;
+  uint16_t w, h;
+  polygon_t outline;
+  uint16_t corners[10];
+} rectangle_t;
+
+
 typedef struct poly_iter_s {
   iter_base_t base;
-  int idx; // next y not processed
-  edge_t **edges;
+  int idx; // next edge not yet active
+  edge_t *edges; // the shape's edges, read only
   int n_edges;
-  edge_t *active[MAX_ACTIVE];
-  int16_t x_coords[MAX_ACTIVE];
-  uint16_t idmap[MAX_ACTIVE];
-  int n_active, cur, width;
-  uint16_t ty, tx, y0, y;
+  // Active edge table as parallel arrays in x order, the num steps taken
+  // two edges at a time. x advances by xstep a line and one dir more each
+  // time num reaches den.
+  int32_t *x, *xstep;
+  int16_t *num, *nstep, *den, *dir, *ybot, *wind;
+  int n_active, max_active, cur;
+  int32_t tx, ty;
+  uint16_t y, y_end; // current and last visible line, shape coordinates
   bool fill, stroke;
   uint8_t fclr, sclr;
 } poly_iter_t;
 
 
+typedef struct ellipse_s {
+  transform_t tr; // center
+  bool fill, stroke;
+  uint8_t fclr,sclr;
+  uint16_t rx, ry;
+  int width;
+  int16_t start, sweep; // degrees clockwise from +x, sweep 360 is whole
+} ellipse_t;
+
+// One ellipse boundary, x half-width stepped a line at a time
+typedef struct ell_track_s {
+  int64_t f;     // x^2*b + dy^2*a - a*b
+  int64_t a, b;  // RX^2 and RY^2+RY
+  int32_t x, dy; // x in XFX units, -1 when the line misses
+  int32_t ry;
+} ell_track_t;
+
+typedef struct ellipse_iter_s {
+  iter_base_t base;
+  ell_track_t outer, inner;
+  bool ring, arc;
+  int32_t cx, y, y2;
+  int32_t k0, k1;       // XFX x per line along the start and end rays, 8.8
+  int16_t start, end;   // end = start+sweep, may pass 360
+  uint16_t runs[8];
+  int n_runs, cur;
+  uint8_t clr;
+} ellipse_iter_t;
+
+// 1 or 2 bit per pixel image kept as the runs of equal pixels of each
+// row, in pixels with the colour looked up. Pixel value 0 is clear.
+typedef struct bitmap_s {
+  transform_t tr; // top left, only translation applies
+  uint16_t w, h;
+  run_t *runs;
+  uint16_t *rows; // first run of each row, h+1 entries
+} bitmap_t;
+
+// A line of text in a txt2cfont -s font, its glyph runs gathered into
+// rows when the string is set and drawn as a bitmap after that
+typedef struct text_s {
+  bitmap_t bmp; // starts with the transform, like every shape
+  uint8_t const *font;
+  uint16_t const *index; // offset of each glyph in font, from txt2cfont
+  uint8_t clr;
+  int cap; // runs allocated, kept when the string changes
+} text_t;
+
+typedef struct bitmap_iter_s {
+  iter_base_t base;
+  bitmap_t *bmp;
+  int32_t tx, ty;
+  int y, y_end; // current and last visible row
+  int cur; // next run of row y
+} bitmap_iter_t;
+
+
+extern void vgr2d_arena_init(vgr2d_arena_t *arena, void *mem, size_t size);
+extern void *vgr2d_arena_alloc(vgr2d_arena_t *arena, size_t size);
+extern void vgr2d_arena_reset(vgr2d_arena_t *arena);
+
 extern void init_transform(transform_t *tr);
+extern void transform_set_linear(transform_t *tr, int deg, int32_t sx, int32_t sy);
+extern void transform_set_pivot(transform_t *tr, int32_t px, int32_t py);
+extern bool transform_identity(transform_t *tr);
+extern polygon_t *rectangle_outline(rectangle_t *rect);
 extern void init_rectangle_iter(rectangle_t *rect, rect_iter_t *iter);
+extern void polygon_build_edges(polygon_t *poly);
 extern void init_polygon_iter(polygon_t *poly, poly_iter_t *iter);
+extern void rectangle_bounds(rectangle_t *rect, bbox_t *bb);
+extern bool vgr2d_visible(bbox_t *bb);
+extern void polygon_bounds(polygon_t *poly, bbox_t *bb);
+extern void init_ellipse_iter(ellipse_t *ell, ellipse_iter_t *iter);
+extern void ellipse_bounds(ellipse_t *ell, bbox_t *bb);
+extern int bitmap_encode(bitmap_t *bmp, const uint8_t *data, int bpp, const uint8_t *clr);
+extern void init_bitmap_iter(bitmap_t *bmp, bitmap_iter_t *iter);
+extern void bitmap_bounds(bitmap_t *bmp, bbox_t *bb);
+extern int text_encode(text_t *text, char const *s, size_t len);
+
+extern int vgr2d_sin(int deg);
+extern int vgr2d_cos(int deg);
 
 #endif
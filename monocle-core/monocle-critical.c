@@ -213,7 +213,7 @@ void monocle_critical_startup(void)
         config.mode = NRF_SPIM_MODE_3;
         config.bit_order = NRF_SPIM_BIT_ORDER_LSB_FIRST;
 
-        app_err(nrfx_spim_init(&spi_bus_2, &config, NULL, NULL));
+        app_err(nrfx_spim_init(&spi_bus_2, &config, spi_event_handler, NULL));
     }
 
     // This wont return if Monocle is charging
@@ -217,28 +217,136 @@ i2c_response_t i2c_write(uint8_t device_address_7bit,
     return resp;
 }
 
-void spi_read(spi_device_t spi_device, uint8_t *data, size_t length)
+/**
+ * @brief Generic SPI driver.
+ *
+ * The SPIM runs with an event handler. spi_read() and spi_write() still
+ * block until their own transfer ends, but first wait for any background
+ * stream, so transfers go out in the order they were issued.
+ */
+
+// EasyDMA transfer counts are 8 bits wide on the nRF52832
+#define SPI_DMA_MAX 255
+
+static volatile bool spi_xfer_done;
+
+static struct
 {
+    uint8_t *data;
+    size_t length;
     uint8_t cs_pin;
+    volatile bool busy;
+} spi_stream;
 
+static uint8_t spi_cs_pin(spi_device_t spi_device)
+{
     switch (spi_device)
     {
     case DISPLAY:
-        cs_pin = DISPLAY_CS_PIN;
-        break;
+        return DISPLAY_CS_PIN;
     case FPGA:
-        cs_pin = FPGA_CS_INT_MODE_PIN;
-        break;
+        return FPGA_CS_INT_MODE_PIN;
     case FLASH:
-        cs_pin = FLASH_CS_PIN;
-        break;
+    default:
+        return FLASH_CS_PIN;
+    }
+}
+
+static void spi_xfer(nrfx_spim_xfer_desc_t const *xfer)
+{
+    spi_xfer_done = false;
+    app_err(nrfx_spim_xfer(&spi_bus_2, xfer, 0));
+
+    while (!spi_xfer_done)
+    {
+        __WFE();
+    }
+}
+
+// Start the next chunk of the background stream
+static void spi_stream_next(void)
+{
+    size_t length = spi_stream.length;
+
+    if (length > SPI_DMA_MAX)
+    {
+        length = SPI_DMA_MAX;
+    }
+
+    nrfx_spim_xfer_desc_t xfer = NRFX_SPIM_XFER_TX(spi_stream.data, length);
+    spi_stream.data += length;
+    spi_stream.length -= length;
+    app_err(nrfx_spim_xfer(&spi_bus_2, &xfer, 0));
+}
+
+void spi_event_handler(nrfx_spim_evt_t const *event, void *context)
+{
+    (void)context;
+
+    if (event->type != NRFX_SPIM_EVENT_DONE)
+    {
+        return;
+    }
+
+    if (!spi_stream.busy)
+    {
+        spi_xfer_done = true;
+        return;
+    }
+
+    // Chain the chunks of a stream from the end event, then release CS
+    if (spi_stream.length > 0)
+    {
+        spi_stream_next();
+        return;
     }
 
+    nrf_gpio_pin_set(spi_stream.cs_pin);
+    spi_stream.busy = false;
+}
+
+bool spi_stream_busy(void)
+{
+    return spi_stream.busy;
+}
+
+void spi_stream_wait(void)
+{
+    while (spi_stream.busy)
+    {
+        __WFE();
+    }
+}
+
+void spi_write_background(spi_device_t spi_device, uint8_t *data,
+                          size_t length)
+{
+    spi_stream_wait();
+
+    if (length == 0)
+    {
+        return;
+    }
+
+    // data must stay untouched in RAM until spi_stream_busy() is false
+    spi_stream.data = data;
+    spi_stream.length = length;
+    spi_stream.cs_pin = spi_cs_pin(spi_device);
+    spi_stream.busy = true;
+
+    nrf_gpio_pin_clear(spi_stream.cs_pin);
+    spi_stream_next();
+}
+
+void spi_read(spi_device_t spi_device, uint8_t *data, size_t length)
+{
+    uint8_t cs_pin = spi_cs_pin(spi_device);
+
+    spi_stream_wait();
     nrf_gpio_pin_clear(cs_pin);
 
-    // TODO prevent blocking here, and add a mutex
     nrfx_spim_xfer_desc_t xfer = NRFX_SPIM_XFER_RX(data, length);
-    app_err(nrfx_spim_xfer(&spi_bus_2, &xfer, 0));
+    spi_xfer(&xfer);
 
     nrf_gpio_pin_set(cs_pin);
 }
@@ -246,29 +354,16 @@ void spi_read(spi_device_t spi_device, uint8_t *data, size_t length)
 void spi_write(spi_device_t spi_device, uint8_t *data, size_t length,
                bool hold_down_cs)
 {
-    uint8_t cs_pin;
-
-    switch (spi_device)
-    {
-    case DISPLAY:
-        cs_pin = DISPLAY_CS_PIN;
-        break;
-    case FPGA:
-        cs_pin = FPGA_CS_INT_MODE_PIN;
-        break;
-    case FLASH:
-        cs_pin = FLASH_CS_PIN;
-        break;
-    }
+    uint8_t cs_pin = spi_cs_pin(spi_device);
 
+    spi_stream_wait();
     nrf_gpio_pin_clear(cs_pin);
 
-    // TODO prevent blocking here, and add a mutex
     nrfx_spim_xfer_desc_t xfer = NRFX_SPIM_XFER_TX(data, length);
-    app_err(nrfx_spim_xfer(&spi_bus_2, &xfer, 0));
+    spi_xfer(&xfer);
 
     if (!hold_down_cs)
     {
         nrf_gpio_pin_set(cs_pin);
     }
-}
\ No newline at end of file
+}
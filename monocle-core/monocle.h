@@ -28,6 +28,7 @@
 #include <stdbool.h>
 #include "nrfx.h"
 #include "nrfx_log.h"
+#include "nrfx_spim.h"
 
 /**
  * @brief Monocle PCB pinout.
@@ -130,6 +131,15 @@ void spi_read(spi_device_t spi_device, uint8_t *data, size_t length);
 void spi_write(spi_device_t spi_device, uint8_t *data, size_t length,
                bool hold_down_cs);
 
+void spi_write_background(spi_device_t spi_device, uint8_t *data,
+                          size_t length);
+
+bool spi_stream_busy(void);
+
+void spi_stream_wait(void);
+
+void spi_event_handler(nrfx_spim_evt_t const *event, void *context);
+
 /**
  * @brief Error handling macro.
  */
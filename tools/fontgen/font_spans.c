@@ -0,0 +1,998 @@
+#include <stdint.h>
+
+/* generated by ./txt2cfont */
+
+uint8_t const font_50_spans[] = {
+
+	/* height */ 50,
+
+	/*   */ 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ! */ 4, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 48, 48, 48, 48, 48, 48, 50, 52, 54, 56, 58, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* " */ 12, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4,
+	/* # */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 34, 36, 38, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 90, 92, 94, 96, 100, 104, 108, 112, 116, 120, 124, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 0, 20, 0, 20, 0, 20, 0, 20, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 0, 20, 0, 20, 0, 20, 0, 20, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4,
+	/* $ */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 20, 26, 32, 38, 42, 46, 50, 54, 58, 62, 66, 70, 72, 74, 76, 78, 82, 86, 90, 94, 98, 102, 106, 110, 116, 122, 128, 134, 136, 138, 140, 142, 144, 146, 148, 150, 150, 150, 150, 150, 150, 150, 150, 8, 4, 8, 4, 8, 4, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 8, 4, 14, 6, 0, 6, 8, 4, 14, 6, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 4, 8, 4, 0, 6, 8, 4, 0, 6, 8, 4, 2, 14, 2, 14, 4, 14, 4, 14, 8, 4, 14, 6, 8, 4, 14, 6, 8, 4, 16, 4, 8, 4, 16, 4, 8, 4, 16, 4, 8, 4, 16, 4, 8, 4, 16, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 6, 8, 4, 14, 6, 0, 6, 8, 4, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* % */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 76, 80, 84, 88, 92, 96, 100, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 2, 4, 16, 4, 2, 4, 16, 4, 0, 8, 14, 6, 0, 8, 14, 6, 0, 8, 14, 6, 0, 8, 14, 6, 2, 4, 12, 6, 2, 4, 12, 6, 12, 6, 12, 6, 10, 6, 10, 6, 10, 6, 10, 6, 8, 6, 8, 6, 8, 6, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 6, 4, 6, 4, 6, 4, 6, 2, 6, 2, 6, 2, 6, 14, 4, 2, 6, 14, 4, 0, 6, 12, 8, 0, 6, 12, 8, 0, 6, 12, 8, 0, 6, 12, 8, 0, 4, 14, 4, 0, 4, 14, 4,
+	/* & */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 6, 6, 6, 6, 4, 10, 4, 10, 2, 6, 10, 6, 2, 6, 10, 6, 2, 4, 12, 4, 2, 4, 12, 4, 2, 4, 12, 4, 2, 4, 12, 4, 2, 6, 10, 6, 2, 6, 10, 6, 4, 10, 4, 10, 6, 6, 6, 6, 4, 10, 16, 4, 4, 10, 16, 4, 2, 12, 16, 4, 2, 12, 16, 4, 0, 6, 10, 10, 0, 6, 10, 10, 0, 4, 10, 8, 0, 4, 10, 8, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 10, 10, 0, 4, 10, 10, 0, 6, 10, 10, 0, 6, 10, 10, 2, 12, 16, 4, 2, 12, 16, 4, 4, 8, 16, 4, 4, 8, 16, 4,
+	/* ' */ 4, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* ( */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 8, 4, 8, 4, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 2, 4, 2, 4, 0, 6, 0, 6, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 2, 4, 2, 4, 2, 6, 2, 6, 4, 6, 4, 6, 6, 6, 6, 6, 8, 4, 8, 4,
+	/* ) */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 4, 0, 4, 0, 6, 0, 6, 2, 6, 2, 6, 4, 6, 4, 6, 6, 6, 6, 6, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 0, 6, 0, 6, 0, 4, 0, 4,
+	/* * */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 14, 20, 26, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 62, 68, 74, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 8, 4, 8, 4, 8, 4, 8, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 6, 8, 4, 14, 6, 0, 6, 8, 4, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12, 6, 8, 6, 8, 6, 8, 6, 8, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 8, 4, 14, 6, 0, 6, 8, 4, 14, 6, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* + */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 0, 20, 0, 20, 0, 20, 0, 20, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* , */ 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 32, 32, 32, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 6, 2, 6, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 2, 4, 0, 4, 0, 4,
+	/* - */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* . */ 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 4, 2, 4,
+	/* / */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 16, 4, 16, 4, 16, 4, 16, 4, 14, 6, 14, 6, 14, 4, 14, 4, 12, 6, 12, 6, 12, 4, 12, 4, 10, 6, 10, 6, 10, 4, 10, 4, 8, 4, 8, 4, 8, 4, 8, 4, 6, 4, 6, 4, 4, 6, 4, 6, 4, 4, 4, 4, 2, 6, 2, 6, 2, 4, 2, 4, 0, 6, 0, 6, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* 0 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 62, 68, 74, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 130, 132, 134, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 4, 12, 4, 12, 2, 16, 2, 16, 2, 4, 14, 4, 2, 4, 14, 4, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* 1 */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 4, 4, 4, 4, 4, 4, 4, 2, 6, 2, 6, 2, 6, 2, 6, 0, 8, 0, 8, 0, 8, 0, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 12, 0, 12, 0, 12, 0, 12,
+	/* 2 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 16, 4, 16, 4, 14, 6, 14, 6, 12, 6, 12, 6, 10, 6, 10, 6, 8, 6, 8, 6, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 0, 6, 0, 6, 0, 4, 0, 4, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* 3 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 68, 72, 76, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 14, 6, 14, 6, 4, 14, 4, 14, 4, 14, 4, 14, 14, 6, 14, 6, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* 4 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 16, 4, 16, 4, 14, 6, 14, 6, 12, 8, 12, 8, 10, 10, 10, 10, 8, 6, 16, 4, 8, 6, 16, 4, 6, 6, 16, 4, 6, 6, 16, 4, 4, 6, 16, 4, 4, 6, 16, 4, 2, 6, 16, 4, 2, 6, 16, 4, 0, 6, 16, 4, 0, 6, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 20, 0, 20, 0, 20, 0, 20, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4,
+	/* 5 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 60, 64, 68, 72, 74, 76, 78, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 0, 20, 0, 20, 0, 20, 0, 20, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 16, 0, 16, 0, 18, 0, 18, 14, 6, 14, 6, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* 6 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 98, 100, 102, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 16, 0, 16, 0, 18, 0, 18, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* 7 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 20, 0, 20, 0, 20, 0, 20, 16, 4, 16, 4, 16, 4, 16, 4, 14, 6, 14, 6, 14, 4, 14, 4, 12, 6, 12, 6, 12, 4, 12, 4, 10, 6, 10, 6, 10, 4, 10, 4, 8, 6, 8, 6, 8, 4, 8, 4, 6, 6, 6, 6, 6, 4, 6, 4, 4, 6, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	/* 8 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 114, 116, 118, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* 9 */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 84, 88, 92, 96, 98, 100, 102, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 16, 4, 0, 6, 16, 4, 2, 18, 2, 18, 4, 16, 4, 16, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* : */ 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 20, 22, 24, 26, 28, 30, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 4, 2, 4, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 4, 2, 4,
+	/* ; */ 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 48, 48, 48, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 4, 2, 4, 2, 4, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 6, 2, 6, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 2, 4, 0, 4, 0, 4,
+	/* < */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 16, 4, 16, 4, 14, 6, 14, 6, 12, 6, 12, 6, 10, 6, 10, 6, 8, 6, 8, 6, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 0, 6, 0, 6, 0, 6, 0, 6, 2, 6, 2, 6, 4, 6, 4, 6, 6, 6, 6, 6, 8, 6, 8, 6, 10, 6, 10, 6, 12, 6, 12, 6, 14, 6, 14, 6, 16, 4, 16, 4,
+	/* = */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10, 12, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 20, 0, 20, 0, 20, 0, 20, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* > */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 4, 0, 4, 0, 6, 0, 6, 2, 6, 2, 6, 4, 6, 4, 6, 6, 6, 6, 6, 8, 6, 8, 6, 10, 6, 10, 6, 12, 6, 12, 6, 14, 6, 14, 6, 14, 6, 14, 6, 12, 6, 12, 6, 10, 6, 10, 6, 8, 6, 8, 6, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 0, 6, 0, 6, 0, 4, 0, 4,
+	/* ? */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 68, 68, 68, 68, 70, 72, 74, 76, 78, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 16, 4, 16, 4, 14, 6, 14, 6, 12, 6, 12, 6, 10, 6, 10, 6, 8, 6, 8, 6, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* @ */ 28, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 30, 36, 42, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120, 128, 136, 144, 148, 152, 156, 160, 162, 164, 166, 168, 170, 172, 174, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 4, 20, 4, 20, 2, 24, 2, 24, 0, 6, 22, 6, 0, 6, 22, 6, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 10, 10, 24, 4, 0, 4, 10, 10, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 22, 6, 0, 4, 8, 4, 16, 4, 22, 6, 0, 4, 8, 18, 0, 4, 8, 18, 0, 4, 10, 14, 0, 4, 10, 14, 0, 4, 0, 4, 0, 6, 0, 6, 2, 22, 2, 22, 4, 20, 4, 20,
+	/* A */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 74, 76, 78, 80, 84, 88, 92, 96, 100, 104, 108, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 8, 4, 8, 4, 8, 4, 8, 4, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 4, 12, 4, 12, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 2, 6, 12, 6, 2, 6, 12, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 16, 2, 16, 0, 20, 0, 20, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* B */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 114, 116, 118, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 0, 16, 0, 16, 0, 18, 0, 18, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 18, 0, 18, 0, 18, 0, 18, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 18, 0, 18, 0, 16, 0, 16,
+	/* C */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 68, 72, 76, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* D */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 122, 124, 126, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 16, 0, 16, 0, 18, 0, 18, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 18, 0, 18, 0, 16, 0, 16,
+	/* E */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 20, 0, 20, 0, 20, 0, 20, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 16, 0, 16, 0, 16, 0, 16, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* F */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 20, 0, 20, 0, 20, 0, 20, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 16, 0, 16, 0, 16, 0, 16, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* G */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 98, 100, 102, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* H */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 66, 68, 70, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 132, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 20, 0, 20, 0, 20, 0, 20, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* I */ 8, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 8, 0, 8, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 0, 8, 0, 8,
+	/* J */ 16, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 60, 64, 68, 72, 74, 76, 78, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 8, 8, 8, 8, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 0, 2, 10, 4, 0, 2, 10, 4, 0, 4, 8, 6, 0, 4, 8, 6, 0, 12, 0, 12, 2, 8, 2, 8,
+	/* K */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 66, 68, 70, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 10, 6, 0, 4, 10, 6, 0, 4, 8, 6, 0, 4, 8, 6, 0, 4, 6, 6, 0, 4, 6, 6, 0, 10, 0, 10, 0, 8, 0, 8, 0, 8, 0, 8, 0, 10, 0, 10, 0, 4, 6, 6, 0, 4, 6, 6, 0, 4, 8, 6, 0, 4, 8, 6, 0, 4, 10, 6, 0, 4, 10, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* L */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* M */ 28, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 48, 56, 64, 72, 80, 88, 94, 100, 106, 112, 118, 124, 130, 136, 142, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 0, 4, 24, 4, 0, 4, 24, 4, 0, 6, 22, 6, 0, 6, 22, 6, 0, 8, 20, 8, 0, 8, 20, 8, 0, 8, 20, 8, 0, 8, 20, 8, 0, 10, 18, 10, 0, 10, 18, 10, 0, 4, 6, 4, 18, 4, 24, 4, 0, 4, 6, 4, 18, 4, 24, 4, 0, 4, 6, 6, 16, 6, 24, 4, 0, 4, 6, 6, 16, 6, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4,
+	/* N */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 38, 44, 50, 56, 62, 68, 74, 80, 86, 92, 98, 104, 110, 116, 122, 128, 134, 140, 146, 152, 156, 160, 164, 168, 172, 176, 180, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 0, 6, 16, 4, 0, 6, 16, 4, 0, 6, 16, 4, 0, 6, 16, 4, 0, 8, 16, 4, 0, 8, 16, 4, 0, 8, 16, 4, 0, 8, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 6, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 10, 4, 16, 4, 0, 4, 12, 8, 0, 4, 12, 8, 0, 4, 12, 8, 0, 4, 12, 8, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 14, 6,
+	/* O */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 122, 124, 126, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* P */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 0, 16, 0, 16, 0, 18, 0, 18, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 18, 0, 18, 0, 16, 0, 16, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* Q */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 110, 116, 120, 124, 126, 128, 130, 132, 134, 136, 138, 140, 140, 140, 140, 140, 140, 140, 140, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 4, 8, 4, 16, 4, 0, 6, 8, 12, 0, 6, 8, 12, 2, 16, 2, 16, 4, 14, 4, 14, 14, 6, 14, 6, 16, 4, 16, 4,
+	/* R */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 74, 76, 78, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 16, 0, 16, 0, 18, 0, 18, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 18, 0, 18, 0, 16, 0, 16, 0, 4, 6, 6, 0, 4, 6, 6, 0, 4, 8, 6, 0, 4, 8, 6, 0, 4, 10, 6, 0, 4, 10, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* S */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 68, 72, 76, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 6, 0, 6, 2, 14, 2, 14, 4, 14, 4, 14, 14, 6, 14, 6, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* T */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 20, 0, 20, 0, 20, 0, 20, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* U */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 130, 132, 134, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* V */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 6, 12, 6, 2, 6, 12, 6, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 12, 4, 12, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 8, 4, 8, 4,
+	/* W */ 28, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 46, 52, 58, 64, 70, 76, 82, 88, 94, 100, 108, 116, 124, 132, 140, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 10, 8, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 8, 12, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 8, 4, 16, 4, 24, 4, 0, 4, 6, 6, 16, 6, 24, 4, 0, 4, 6, 6, 16, 6, 24, 4, 0, 4, 6, 4, 18, 4, 24, 4, 0, 4, 6, 4, 18, 4, 24, 4, 0, 10, 18, 10, 0, 10, 18, 10, 0, 8, 20, 8, 0, 8, 20, 8, 0, 8, 20, 8, 0, 8, 20, 8, 0, 6, 22, 6, 0, 6, 22, 6, 0, 4, 24, 4, 0, 4, 24, 4,
+	/* X */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 66, 68, 70, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 6, 12, 6, 2, 6, 12, 6, 4, 4, 12, 4, 4, 4, 12, 4, 4, 12, 4, 12, 6, 8, 6, 8, 6, 8, 6, 8, 4, 12, 4, 12, 4, 4, 12, 4, 4, 4, 12, 4, 2, 6, 12, 6, 2, 6, 12, 6, 2, 4, 14, 4, 2, 4, 14, 4, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* Y */ 20, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 6, 12, 6, 2, 6, 12, 6, 4, 4, 12, 4, 4, 4, 12, 4, 4, 12, 4, 12, 6, 8, 6, 8, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* Z */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 20, 0, 20, 0, 20, 0, 20, 14, 6, 14, 6, 14, 4, 14, 4, 12, 6, 12, 6, 12, 4, 12, 4, 10, 6, 10, 6, 10, 4, 10, 4, 8, 4, 8, 4, 8, 4, 8, 4, 6, 4, 6, 4, 4, 6, 4, 6, 4, 4, 4, 4, 2, 6, 2, 6, 2, 4, 2, 4, 0, 6, 0, 6, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* [ */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 12, 0, 12, 0, 12, 0, 12, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 12, 0, 12, 0, 12, 0, 12,
+	/* \ */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 4, 0, 4, 0, 4, 0, 4, 0, 6, 0, 6, 2, 4, 2, 4, 2, 6, 2, 6, 4, 4, 4, 4, 4, 6, 4, 6, 6, 4, 6, 4, 8, 4, 8, 4, 8, 4, 8, 4, 10, 4, 10, 4, 10, 6, 10, 6, 12, 4, 12, 4, 12, 6, 12, 6, 14, 4, 14, 4, 14, 6, 14, 6, 16, 4, 16, 4, 16, 4, 16, 4,
+	/* ] */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 12, 0, 12, 0, 12, 0, 12, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 0, 12, 0, 12, 0, 12, 0, 12,
+	/* ^ */ 20, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 16, 20, 24, 28, 32, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 8, 4, 8, 4, 6, 8, 6, 8, 4, 12, 4, 12, 2, 6, 12, 6, 2, 6, 12, 6, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* _ */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 8, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* ` */ 12, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 4, 0, 4, 0, 6, 0, 6, 2, 6, 2, 6, 4, 6, 4, 6, 6, 6, 6, 6, 8, 4, 8, 4,
+	/* a */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 44, 48, 52, 56, 60, 64, 68, 72, 74, 76, 80, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 4, 16, 4, 16, 2, 18, 2, 18, 0, 6, 16, 4, 0, 6, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 10, 16, 4, 4, 10, 16, 4,
+	/* b */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 26, 30, 32, 34, 38, 42, 46, 50, 54, 58, 62, 66, 70, 74, 78, 82, 86, 90, 94, 98, 102, 106, 110, 114, 116, 118, 122, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 6, 10, 0, 4, 6, 10, 0, 18, 0, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 0, 18, 0, 18, 0, 4, 6, 10, 0, 4, 6, 10,
+	/* c */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 52, 56, 60, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* d */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 26, 30, 32, 34, 38, 42, 46, 50, 54, 58, 62, 66, 70, 74, 78, 82, 86, 90, 94, 98, 102, 106, 110, 114, 116, 118, 122, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 4, 10, 16, 4, 4, 10, 16, 4, 2, 18, 2, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 12, 18, 2, 4, 12, 18, 2,
+	/* e */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 20, 0, 20, 0, 20, 0, 20, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 6, 0, 6, 2, 14, 2, 14, 4, 12, 4, 12,
+	/* f */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 8, 12, 6, 14, 6, 14, 4, 6, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 16, 0, 16, 0, 16, 0, 16, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	/* g */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 10, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 94, 96, 100, 104, 106, 108, 110, 112, 114, 116, 120, 124, 126, 128, 130, 4, 10, 16, 4, 4, 10, 16, 4, 2, 18, 2, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 10, 16, 4, 4, 10, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 2, 16, 2, 16, 4, 12,
+	/* h */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 26, 30, 32, 34, 38, 42, 46, 50, 54, 58, 62, 66, 70, 74, 78, 82, 86, 90, 94, 98, 102, 106, 110, 114, 118, 122, 126, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 6, 10, 0, 4, 6, 10, 0, 18, 0, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* i */ 8, 0, 2, 4, 6, 8, 10, 12, 14, 14, 14, 14, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 2, 4, 0, 8, 0, 8, 0, 8, 0, 8, 2, 4, 2, 4, 0, 6, 0, 6, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 0, 8, 0, 8,
+	/* j */ 16, 0, 2, 4, 6, 8, 10, 12, 14, 14, 14, 14, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 82, 86, 90, 94, 96, 98, 100, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 8, 8, 8, 8, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 10, 4, 0, 2, 10, 4, 0, 2, 10, 4, 0, 4, 8, 6, 0, 4, 8, 6, 0, 12, 0, 12, 2, 8,
+	/* k */ 20, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 26, 30, 34, 38, 42, 46, 50, 54, 58, 62, 66, 70, 72, 74, 76, 78, 82, 86, 90, 94, 98, 102, 106, 110, 114, 118, 122, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 10, 6, 0, 4, 10, 6, 0, 4, 8, 6, 0, 4, 8, 6, 0, 4, 6, 6, 0, 4, 6, 6, 0, 10, 0, 10, 0, 10, 0, 10, 0, 4, 6, 6, 0, 4, 6, 6, 0, 4, 8, 6, 0, 4, 8, 6, 0, 4, 10, 6, 0, 4, 10, 6, 0, 4, 12, 6, 0, 4, 12, 6, 0, 4, 14, 6, 0, 4, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* l */ 8, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0, 6, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 0, 8, 0, 8,
+	/* m */ 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 12, 14, 16, 22, 28, 34, 40, 46, 52, 58, 64, 70, 76, 82, 88, 94, 100, 106, 112, 118, 124, 130, 136, 142, 148, 154, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 0, 4, 6, 6, 16, 8, 0, 4, 6, 6, 16, 8, 0, 26, 0, 26, 0, 6, 10, 8, 22, 6, 0, 6, 10, 8, 22, 6, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4,
+	/* n */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 10, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 0, 4, 6, 10, 0, 4, 6, 10, 0, 18, 0, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* o */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 90, 92, 94, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* p */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 10, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 94, 96, 100, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126, 0, 4, 6, 10, 0, 4, 6, 10, 0, 18, 0, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 0, 18, 0, 18, 0, 4, 6, 10, 0, 4, 6, 10, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* q */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 10, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 94, 96, 100, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126, 4, 10, 16, 4, 4, 10, 16, 4, 2, 18, 2, 18, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 10, 16, 4, 4, 10, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4,
+	/* r */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 0, 4, 6, 14, 0, 4, 6, 14, 0, 20, 0, 20, 0, 8, 0, 8, 0, 6, 0, 6, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* s */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 52, 56, 60, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 12, 4, 12, 2, 16, 2, 16, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 2, 0, 4, 16, 2, 0, 4, 0, 4, 0, 6, 0, 6, 2, 14, 2, 14, 4, 14, 4, 14, 14, 6, 14, 6, 16, 4, 16, 4, 2, 2, 16, 4, 2, 2, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 16, 2, 16, 4, 12, 4, 12,
+	/* t */ 18, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 70, 74, 76, 78, 80, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 16, 0, 16, 0, 16, 0, 16, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 16, 2, 4, 6, 16, 2, 6, 12, 6, 12, 8, 8, 8, 8,
+	/* u */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 98, 100, 104, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 10, 16, 4, 4, 10, 16, 4,
+	/* v */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 82, 84, 86, 88, 90, 92, 94, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 2, 4, 14, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 4, 4, 12, 4, 6, 8, 6, 8, 6, 8, 6, 8, 8, 4, 8, 4, 8, 4, 8, 4,
+	/* w */ 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 72, 78, 84, 90, 96, 102, 108, 114, 120, 122, 124, 128, 132, 136, 140, 144, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 4, 12, 4, 24, 4, 0, 6, 10, 8, 22, 6, 0, 6, 10, 8, 22, 6, 0, 6, 10, 8, 22, 6, 0, 6, 10, 8, 22, 6, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 4, 10, 8, 22, 4, 2, 24, 2, 24, 4, 8, 16, 8, 4, 8, 16, 8, 4, 6, 18, 6, 4, 6, 18, 6, 6, 4, 18, 4, 6, 4, 18, 4,
+	/* x */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 50, 52, 54, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 4, 14, 4, 2, 4, 14, 4, 2, 6, 12, 6, 2, 6, 12, 6, 4, 4, 12, 4, 4, 4, 12, 4, 4, 12, 4, 12, 6, 8, 6, 8, 6, 8, 6, 8, 4, 12, 4, 12, 4, 4, 12, 4, 4, 4, 12, 4, 2, 6, 12, 6, 2, 6, 12, 6, 2, 4, 14, 4, 2, 4, 14, 4, 0, 6, 14, 6, 0, 6, 14, 6, 0, 4, 16, 4, 0, 4, 16, 4,
+	/* y */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 98, 100, 104, 108, 110, 112, 114, 116, 118, 120, 124, 128, 130, 132, 134, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 4, 16, 4, 0, 6, 14, 6, 0, 6, 14, 6, 2, 18, 2, 18, 4, 10, 16, 4, 4, 10, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 16, 4, 0, 4, 14, 6, 0, 4, 14, 6, 2, 16, 2, 16, 4, 12,
+	/* z */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0, 20, 0, 20, 0, 20, 0, 20, 16, 4, 16, 4, 14, 6, 14, 6, 12, 6, 12, 6, 10, 6, 10, 6, 8, 6, 8, 6, 6, 6, 6, 6, 4, 6, 4, 6, 2, 6, 2, 6, 0, 6, 0, 6, 0, 4, 0, 4, 0, 20, 0, 20, 0, 20, 0, 20,
+	/* { */ 10, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 4, 6, 4, 6, 2, 8, 2, 8, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 0, 4, 0, 4, 0, 4, 0, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 8, 2, 8, 4, 6, 4, 6,
+	/* | */ 4, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+	/* } */ 10, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 6, 0, 6, 0, 8, 0, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 4, 6, 4, 6, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 8, 0, 8, 0, 6, 0, 6,
+	/* ~ */ 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 2, 8, 16, 4, 2, 8, 16, 4, 0, 12, 16, 4, 0, 12, 16, 4, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 10, 8, 0, 4, 10, 8,
+};
+
+uint16_t const font_50_spans_index[] = {
+	/*   */ 1,
+	/* ! */ 53,
+	/* " */ 165,
+	/* # */ 265,
+	/* $ */ 445,
+	/* % */ 647,
+	/* & */ 803,
+	/* ' */ 983,
+	/* ( */ 1059,
+	/* ) */ 1183,
+	/* * */ 1307,
+	/* + */ 1447,
+	/* , */ 1555,
+	/* - */ 1639,
+	/* . */ 1699,
+	/* / */ 1767,
+	/* 0 */ 1891,
+	/* 1 */ 2079,
+	/* 2 */ 2203,
+	/* 3 */ 2343,
+	/* 4 */ 2483,
+	/* 5 */ 2631,
+	/* 6 */ 2763,
+	/* 7 */ 2919,
+	/* 8 */ 3043,
+	/* 9 */ 3215,
+	/* : */ 3371,
+	/* ; */ 3455,
+	/* < */ 3555,
+	/* = */ 3679,
+	/* > */ 3747,
+	/* ? */ 3871,
+	/* @ */ 4003,
+	/* A */ 4231,
+	/* B */ 4395,
+	/* C */ 4567,
+	/* D */ 4707,
+	/* E */ 4887,
+	/* F */ 5011,
+	/* G */ 5135,
+	/* H */ 5291,
+	/* I */ 5479,
+	/* J */ 5603,
+	/* K */ 5735,
+	/* L */ 5915,
+	/* M */ 6039,
+	/* N */ 6279,
+	/* O */ 6515,
+	/* P */ 6695,
+	/* Q */ 6851,
+	/* R */ 7043,
+	/* S */ 7223,
+	/* T */ 7363,
+	/* U */ 7487,
+	/* V */ 7675,
+	/* W */ 7851,
+	/* X */ 8091,
+	/* Y */ 8271,
+	/* Z */ 8423,
+	/* [ */ 8547,
+	/* \ */ 8671,
+	/* ] */ 8795,
+	/* ^ */ 8919,
+	/* _ */ 9007,
+	/* ` */ 9067,
+	/* a */ 9143,
+	/* b */ 9279,
+	/* c */ 9457,
+	/* d */ 9581,
+	/* e */ 9759,
+	/* f */ 9883,
+	/* g */ 10013,
+	/* h */ 10195,
+	/* i */ 10377,
+	/* j */ 10499,
+	/* k */ 10651,
+	/* l */ 10829,
+	/* m */ 10959,
+	/* n */ 11171,
+	/* o */ 11331,
+	/* p */ 11479,
+	/* q */ 11657,
+	/* r */ 11835,
+	/* s */ 11947,
+	/* t */ 12071,
+	/* u */ 12205,
+	/* v */ 12365,
+	/* w */ 12513,
+	/* x */ 12713,
+	/* y */ 12861,
+	/* z */ 13047,
+	/* { */ 13155,
+	/* | */ 13279,
+	/* } */ 13403,
+	/* ~ */ 13527,
+};
+
+uint8_t const font_26_spans[] = {
+
+	/* height */ 26,
+
+	/*   */ 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ! */ 2, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 24, 24, 24, 26, 28, 30, 30, 30, 30, 30, 30, 30, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* " */ 6, 0, 0, 0, 4, 8, 12, 16, 20, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 2, 4, 2, 0, 2, 4, 2, 0, 2, 4, 2, 0, 2, 4, 2, 0, 2, 4, 2, 0, 2, 4, 2,
+	/* # */ 10, 0, 0, 0, 4, 8, 12, 16, 18, 20, 24, 28, 32, 36, 40, 44, 46, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 0, 10, 0, 10, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 0, 10, 0, 10, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2,
+	/* $ */ 10, 0, 2, 4, 6, 8, 14, 20, 24, 28, 32, 36, 38, 40, 44, 48, 52, 56, 62, 68, 70, 72, 74, 76, 76, 76, 76, 76, 4, 2, 4, 2, 2, 6, 1, 8, 0, 3, 4, 2, 7, 3, 0, 2, 4, 2, 8, 2, 0, 2, 4, 2, 0, 2, 4, 2, 0, 2, 4, 2, 0, 3, 4, 2, 1, 7, 2, 7, 4, 2, 7, 3, 4, 2, 8, 2, 4, 2, 8, 2, 4, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 3, 4, 2, 7, 3, 1, 8, 2, 6, 4, 2, 4, 2,
+	/* % */ 10, 0, 0, 0, 4, 8, 12, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 40, 44, 48, 52, 52, 52, 52, 52, 52, 52, 1, 2, 8, 2, 0, 4, 7, 3, 0, 4, 7, 3, 1, 2, 6, 3, 6, 3, 5, 3, 5, 3, 4, 3, 4, 3, 3, 3, 3, 3, 2, 3, 2, 3, 1, 3, 1, 3, 7, 2, 0, 3, 6, 4, 0, 3, 6, 4, 0, 2, 7, 2,
+	/* & */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 22, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 3, 3, 2, 5, 1, 3, 5, 3, 1, 2, 6, 2, 1, 2, 6, 2, 1, 3, 5, 3, 2, 5, 3, 3, 2, 5, 8, 2, 1, 6, 8, 2, 0, 3, 5, 5, 0, 2, 5, 4, 0, 2, 6, 3, 0, 2, 6, 3, 0, 2, 5, 5, 0, 3, 5, 5, 1, 6, 8, 2, 2, 4, 8, 2,
+	/* ' */ 2, 0, 0, 0, 2, 4, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* ( */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 4, 2, 3, 3, 2, 3, 1, 3, 1, 2, 0, 3, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 1, 2, 1, 3, 2, 3, 3, 3, 4, 2,
+	/* ) */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 2, 0, 3, 1, 3, 2, 3, 3, 3, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 3, 3, 2, 3, 1, 3, 0, 3, 0, 2,
+	/* * */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 10, 16, 18, 20, 22, 24, 26, 28, 34, 40, 42, 44, 44, 44, 44, 44, 44, 44, 4, 2, 4, 2, 0, 2, 4, 2, 8, 2, 0, 3, 4, 2, 7, 3, 1, 8, 2, 6, 3, 4, 3, 4, 2, 6, 1, 8, 0, 3, 4, 2, 7, 3, 0, 2, 4, 2, 8, 2, 4, 2, 4, 2,
+	/* + */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 28, 28, 28, 28, 28, 28, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 0, 10, 0, 10, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+	/* , */ 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 16, 16, 1, 2, 0, 4, 0, 4, 1, 3, 2, 2, 2, 2, 1, 2, 0, 2,
+	/* - */ 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 10, 0, 10,
+	/* . */ 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 1, 2, 0, 4, 0, 4, 1, 2,
+	/* / */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 8, 2, 8, 2, 7, 3, 7, 2, 6, 3, 6, 2, 5, 3, 5, 2, 4, 2, 4, 2, 3, 2, 2, 3, 2, 2, 1, 3, 1, 2, 0, 3, 0, 2, 0, 2,
+	/* 0 */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 34, 40, 44, 48, 52, 56, 60, 64, 66, 68, 68, 68, 68, 68, 68, 68, 2, 6, 1, 8, 1, 2, 7, 2, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 2, 7, 2, 1, 8, 2, 6,
+	/* 1 */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 2, 2, 2, 2, 1, 3, 1, 3, 0, 4, 0, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 6, 0, 6,
+	/* 2 */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 44, 44, 44, 44, 44, 44, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 8, 2, 7, 3, 6, 3, 5, 3, 4, 3, 3, 3, 2, 3, 1, 3, 0, 3, 0, 2, 0, 10, 0, 10,
+	/* 3 */ 10, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 36, 40, 42, 44, 44, 44, 44, 44, 44, 44, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 8, 2, 8, 2, 8, 2, 7, 3, 2, 7, 2, 7, 7, 3, 8, 2, 8, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* 4 */ 10, 0, 0, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 34, 36, 38, 40, 42, 44, 46, 48, 48, 48, 48, 48, 48, 48, 8, 2, 7, 3, 6, 4, 5, 5, 4, 3, 8, 2, 3, 3, 8, 2, 2, 3, 8, 2, 1, 3, 8, 2, 0, 3, 8, 2, 0, 2, 8, 2, 0, 10, 0, 10, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2,
+	/* 5 */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 32, 36, 38, 40, 40, 40, 40, 40, 40, 40, 0, 10, 0, 10, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 8, 0, 9, 7, 3, 8, 2, 8, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* 6 */ 10, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 28, 32, 36, 40, 44, 48, 50, 52, 52, 52, 52, 52, 52, 52, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 8, 0, 9, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* 7 */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 10, 0, 10, 8, 2, 8, 2, 7, 3, 7, 2, 6, 3, 6, 2, 5, 3, 5, 2, 4, 3, 4, 2, 3, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2,
+	/* 8 */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 30, 32, 36, 40, 44, 48, 52, 56, 58, 60, 60, 60, 60, 60, 60, 60, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* 9 */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 30, 32, 34, 36, 38, 40, 44, 48, 50, 52, 52, 52, 52, 52, 52, 52, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 8, 2, 1, 9, 2, 8, 8, 2, 8, 2, 8, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* : */ 4, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 10, 12, 14, 16, 16, 16, 16, 16, 16, 16, 1, 2, 0, 4, 0, 4, 1, 2, 1, 2, 0, 4, 0, 4, 1, 2,
+	/* ; */ 4, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 8, 8, 10, 12, 14, 16, 18, 20, 22, 24, 24, 24, 1, 2, 0, 4, 0, 4, 1, 2, 1, 2, 0, 4, 0, 4, 1, 3, 2, 2, 2, 2, 1, 2, 0, 2,
+	/* < */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 8, 2, 7, 3, 6, 3, 5, 3, 4, 3, 3, 3, 2, 3, 1, 3, 0, 3, 0, 3, 1, 3, 2, 3, 3, 3, 4, 3, 5, 3, 6, 3, 7, 3, 8, 2,
+	/* = */ 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 4, 4, 6, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 10, 0, 10, 0, 10, 0, 10,
+	/* > */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 2, 0, 3, 1, 3, 2, 3, 3, 3, 4, 3, 5, 3, 6, 3, 7, 3, 7, 3, 6, 3, 5, 3, 4, 3, 3, 3, 2, 3, 1, 3, 0, 3, 0, 2,
+	/* ? */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 22, 24, 26, 28, 30, 32, 34, 34, 34, 36, 38, 40, 40, 40, 40, 40, 40, 40, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 8, 2, 7, 3, 6, 3, 5, 3, 4, 3, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+	/* @ */ 14, 0, 0, 0, 2, 4, 8, 12, 18, 24, 32, 40, 48, 56, 64, 72, 76, 80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 2, 10, 1, 12, 0, 3, 11, 3, 0, 2, 12, 2, 0, 2, 5, 5, 12, 2, 0, 2, 4, 6, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 2, 8, 2, 11, 3, 0, 2, 4, 9, 0, 2, 5, 7, 0, 2, 0, 3, 1, 11, 2, 10,
+	/* A */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 16, 20, 24, 28, 32, 36, 38, 40, 44, 48, 52, 56, 56, 56, 56, 56, 56, 56, 4, 2, 4, 2, 3, 4, 3, 4, 3, 4, 2, 6, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 1, 3, 6, 3, 1, 2, 7, 2, 1, 2, 7, 2, 1, 8, 0, 10, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* B */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 30, 32, 36, 40, 44, 48, 52, 56, 58, 60, 60, 60, 60, 60, 60, 60, 0, 8, 0, 9, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 9, 0, 9, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 9, 0, 8,
+	/* C */ 10, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 36, 40, 42, 44, 44, 44, 44, 44, 44, 44, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* D */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 62, 64, 64, 64, 64, 64, 64, 64, 0, 8, 0, 9, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 9, 0, 8,
+	/* E */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 10, 0, 10, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 8, 0, 8, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 10, 0, 10,
+	/* F */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 10, 0, 10, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 8, 0, 8, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* G */ 10, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 28, 32, 36, 40, 44, 48, 50, 52, 52, 52, 52, 52, 52, 52, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 4, 6, 0, 2, 4, 6, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* H */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 34, 36, 40, 44, 48, 52, 56, 60, 64, 68, 68, 68, 68, 68, 68, 68, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 10, 0, 10, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* I */ 4, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 4, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 4,
+	/* J */ 8, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 32, 36, 38, 40, 40, 40, 40, 40, 40, 40, 4, 4, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 0, 1, 5, 2, 0, 2, 4, 3, 0, 6, 1, 4,
+	/* K */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 30, 32, 34, 36, 40, 44, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 2, 6, 3, 0, 2, 5, 3, 0, 2, 4, 3, 0, 2, 3, 3, 0, 5, 0, 4, 0, 4, 0, 5, 0, 2, 3, 3, 0, 2, 4, 3, 0, 2, 5, 3, 0, 2, 6, 3, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* L */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 10, 0, 10,
+	/* M */ 14, 0, 0, 0, 4, 8, 12, 16, 20, 28, 36, 44, 50, 56, 62, 68, 74, 78, 82, 86, 90, 94, 94, 94, 94, 94, 94, 94, 0, 2, 12, 2, 0, 3, 11, 3, 0, 4, 10, 4, 0, 4, 10, 4, 0, 5, 9, 5, 0, 2, 3, 2, 9, 2, 12, 2, 0, 2, 3, 3, 8, 3, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 4, 6, 12, 2, 0, 2, 5, 4, 12, 2, 0, 2, 5, 4, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2,
+	/* N */ 10, 0, 0, 0, 4, 8, 12, 16, 22, 28, 34, 40, 46, 52, 58, 64, 70, 76, 80, 84, 88, 92, 92, 92, 92, 92, 92, 92, 0, 3, 8, 2, 0, 3, 8, 2, 0, 4, 8, 2, 0, 4, 8, 2, 0, 2, 3, 2, 8, 2, 0, 2, 3, 2, 8, 2, 0, 2, 3, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 2, 5, 2, 8, 2, 0, 2, 5, 2, 8, 2, 0, 2, 5, 2, 8, 2, 0, 2, 6, 4, 0, 2, 6, 4, 0, 2, 7, 3, 0, 2, 7, 3,
+	/* O */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 62, 64, 64, 64, 64, 64, 64, 64, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* P */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 38, 40, 42, 44, 46, 48, 50, 52, 52, 52, 52, 52, 52, 52, 0, 8, 0, 9, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 9, 0, 8, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* Q */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 58, 62, 64, 66, 68, 70, 70, 70, 70, 70, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 4, 2, 8, 2, 0, 3, 4, 6, 1, 8, 2, 7, 7, 3, 8, 2,
+	/* R */ 10, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 38, 40, 44, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 0, 8, 0, 9, 0, 2, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 9, 0, 8, 0, 2, 3, 3, 0, 2, 4, 3, 0, 2, 5, 3, 0, 2, 6, 3, 0, 2, 7, 3, 0, 2, 8, 2,
+	/* S */ 10, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 36, 40, 42, 44, 44, 44, 44, 44, 44, 44, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 0, 2, 0, 2, 0, 3, 1, 7, 2, 7, 7, 3, 8, 2, 8, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* T */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 10, 0, 10, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+	/* U */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 66, 68, 68, 68, 68, 68, 68, 68, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* V */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 54, 56, 58, 60, 62, 62, 62, 62, 62, 62, 62, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 2, 7, 2, 1, 2, 7, 2, 1, 2, 7, 2, 1, 2, 7, 2, 1, 3, 6, 3, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 6, 3, 4, 3, 4, 3, 4, 4, 2,
+	/* W */ 14, 0, 0, 0, 4, 8, 12, 16, 20, 26, 32, 38, 44, 50, 58, 66, 74, 78, 82, 86, 90, 94, 94, 94, 94, 94, 94, 94, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 5, 4, 12, 2, 0, 2, 5, 4, 12, 2, 0, 2, 4, 6, 12, 2, 0, 2, 4, 2, 8, 2, 12, 2, 0, 2, 3, 3, 8, 3, 12, 2, 0, 2, 3, 2, 9, 2, 12, 2, 0, 5, 9, 5, 0, 4, 10, 4, 0, 4, 10, 4, 0, 3, 11, 3, 0, 2, 12, 2,
+	/* X */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 30, 32, 34, 36, 40, 44, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 2, 7, 2, 1, 3, 6, 3, 2, 2, 6, 2, 2, 6, 3, 4, 3, 4, 2, 6, 2, 2, 6, 2, 1, 3, 6, 3, 1, 2, 7, 2, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* Y */ 10, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 50, 50, 50, 50, 50, 50, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 2, 7, 2, 1, 3, 6, 3, 2, 2, 6, 2, 2, 6, 3, 4, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+	/* Z */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 10, 0, 10, 7, 3, 7, 2, 6, 3, 6, 2, 5, 3, 5, 2, 4, 2, 4, 2, 3, 2, 2, 3, 2, 2, 1, 3, 1, 2, 0, 3, 0, 10, 0, 10,
+	/* [ */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 6, 0, 6, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 6, 0, 6,
+	/* \ */ 10, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 2, 0, 2, 0, 3, 1, 2, 1, 3, 2, 2, 2, 3, 3, 2, 4, 2, 4, 2, 5, 2, 5, 3, 6, 2, 6, 3, 7, 2, 7, 3, 8, 2, 8, 2,
+	/* ] */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 6, 0, 6, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 0, 6, 0, 6,
+	/* ^ */ 10, 0, 0, 0, 2, 4, 6, 10, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 4, 2, 3, 4, 2, 6, 1, 3, 6, 3, 0, 3, 7, 3, 0, 2, 8, 2,
+	/* _ */ 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 4, 4, 0, 10, 0, 10,
+	/* ` */ 6, 0, 0, 0, 2, 4, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 2, 0, 3, 1, 3, 2, 3, 3, 3, 4, 2,
+	/* a */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 24, 28, 32, 36, 38, 42, 42, 42, 42, 42, 42, 42, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 8, 2, 8, 2, 2, 8, 1, 9, 0, 3, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 5, 8, 2,
+	/* b */ 10, 0, 2, 4, 6, 8, 10, 12, 16, 18, 22, 26, 30, 34, 38, 42, 46, 50, 54, 58, 60, 64, 64, 64, 64, 64, 64, 64, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 3, 5, 0, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 0, 9, 0, 2, 3, 5,
+	/* c */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 28, 32, 34, 36, 36, 36, 36, 36, 36, 36, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* d */ 10, 0, 2, 4, 6, 8, 10, 12, 16, 18, 22, 26, 30, 34, 38, 42, 46, 50, 54, 58, 60, 64, 64, 64, 64, 64, 64, 64, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 2, 5, 8, 2, 1, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 6, 9, 1,
+	/* e */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 8, 12, 16, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 10, 0, 10, 0, 2, 0, 2, 0, 2, 0, 3, 1, 7, 2, 6,
+	/* f */ 10, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 40, 40, 40, 40, 40, 40, 4, 6, 3, 7, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 8, 0, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	/* g */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 6, 10, 14, 18, 22, 26, 30, 34, 38, 42, 46, 48, 52, 54, 56, 58, 62, 64, 66, 2, 5, 8, 2, 1, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 5, 8, 2, 8, 2, 8, 2, 8, 2, 0, 2, 7, 3, 1, 8, 2, 6,
+	/* h */ 10, 0, 2, 4, 6, 8, 10, 12, 16, 18, 22, 26, 30, 34, 38, 42, 46, 50, 54, 58, 62, 66, 66, 66, 66, 66, 66, 66, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 3, 5, 0, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* i */ 4, 0, 2, 4, 6, 8, 8, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 1, 2, 0, 4, 0, 4, 1, 2, 0, 3, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 4,
+	/* j */ 8, 0, 2, 4, 6, 8, 8, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 44, 48, 50, 52, 5, 2, 5, 2, 5, 2, 5, 2, 4, 4, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 0, 1, 5, 2, 0, 2, 4, 3, 0, 6, 1, 4,
+	/* k */ 10, 0, 2, 4, 6, 8, 10, 12, 16, 20, 24, 28, 32, 36, 38, 40, 44, 48, 52, 56, 60, 64, 64, 64, 64, 64, 64, 64, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 8, 2, 0, 2, 7, 3, 0, 2, 6, 3, 0, 2, 5, 3, 0, 2, 4, 3, 0, 2, 3, 3, 0, 5, 0, 5, 0, 2, 3, 3, 0, 2, 4, 3, 0, 2, 5, 3, 0, 2, 6, 3, 0, 2, 7, 3, 0, 2, 8, 2,
+	/* l */ 4, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 40, 40, 40, 40, 40, 40, 0, 3, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 4,
+	/* m */ 14, 0, 0, 0, 0, 0, 0, 0, 6, 8, 14, 20, 26, 32, 38, 44, 50, 56, 62, 68, 74, 80, 80, 80, 80, 80, 80, 80, 0, 2, 3, 3, 8, 4, 0, 13, 0, 3, 5, 4, 11, 3, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2,
+	/* n */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 6, 10, 14, 18, 22, 26, 30, 34, 38, 42, 46, 50, 54, 54, 54, 54, 54, 54, 54, 0, 2, 3, 5, 0, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2,
+	/* o */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 46, 48, 48, 48, 48, 48, 48, 48, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* p */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 6, 10, 14, 18, 22, 26, 30, 34, 38, 42, 46, 48, 52, 54, 56, 58, 60, 62, 64, 0, 2, 3, 5, 0, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 0, 9, 0, 2, 3, 5, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* q */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 6, 10, 14, 18, 22, 26, 30, 34, 38, 42, 46, 48, 52, 54, 56, 58, 60, 62, 64, 2, 5, 8, 2, 1, 9, 0, 3, 7, 3, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 5, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2, 8, 2,
+	/* r */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 30, 30, 30, 30, 30, 30, 0, 2, 3, 7, 0, 10, 0, 4, 0, 3, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* s */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 8, 12, 14, 16, 18, 20, 22, 24, 28, 32, 34, 36, 36, 36, 36, 36, 36, 36, 2, 6, 1, 8, 0, 3, 7, 3, 0, 2, 8, 1, 0, 2, 0, 3, 1, 7, 2, 7, 7, 3, 8, 2, 1, 1, 8, 2, 0, 3, 7, 3, 1, 8, 2, 6,
+	/* t */ 9, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 38, 40, 42, 42, 42, 42, 42, 42, 42, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 8, 0, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 8, 1, 3, 6, 4, 4,
+	/* u */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 50, 54, 54, 54, 54, 54, 54, 54, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 5, 8, 2,
+	/* v */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 42, 44, 46, 48, 48, 48, 48, 48, 48, 48, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 1, 2, 7, 2, 1, 2, 7, 2, 1, 2, 7, 2, 2, 2, 6, 2, 2, 2, 6, 2, 2, 2, 6, 2, 3, 4, 3, 4, 4, 2, 4, 2,
+	/* w */ 14, 0, 0, 0, 0, 0, 0, 0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 62, 66, 70, 74, 74, 74, 74, 74, 74, 74, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 2, 6, 2, 12, 2, 0, 3, 5, 4, 11, 3, 0, 3, 5, 4, 11, 3, 1, 2, 5, 4, 11, 2, 1, 2, 5, 4, 11, 2, 1, 2, 5, 4, 11, 2, 1, 2, 5, 4, 11, 2, 1, 12, 2, 4, 8, 4, 2, 3, 9, 3, 3, 2, 9, 2,
+	/* x */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 22, 24, 26, 28, 32, 36, 40, 44, 48, 48, 48, 48, 48, 48, 48, 0, 2, 8, 2, 0, 3, 7, 3, 1, 2, 7, 2, 1, 3, 6, 3, 2, 2, 6, 2, 2, 6, 3, 4, 3, 4, 2, 6, 2, 2, 6, 2, 1, 3, 6, 3, 1, 2, 7, 2, 0, 3, 7, 3, 0, 2, 8, 2,
+	/* y */ 10, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 50, 54, 56, 58, 60, 64, 66, 68, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 2, 8, 2, 0, 3, 7, 3, 1, 9, 2, 5, 8, 2, 8, 2, 8, 2, 8, 2, 0, 2, 7, 3, 1, 8, 2, 6,
+	/* z */ 10, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 28, 28, 28, 28, 28, 28, 0, 10, 0, 10, 8, 2, 7, 3, 6, 3, 5, 3, 4, 3, 3, 3, 2, 3, 1, 3, 0, 3, 0, 2, 0, 10, 0, 10,
+	/* { */ 5, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 2, 3, 1, 4, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 2, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 4, 2, 3,
+	/* | */ 2, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* } */ 5, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 36, 36, 36, 36, 36, 36, 0, 3, 0, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 4, 0, 3,
+	/* ~ */ 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 1, 4, 8, 2, 0, 6, 8, 2, 0, 2, 4, 6, 0, 2, 5, 4,
+};
+
+uint16_t const font_26_spans_index[] = {
+	/*   */ 1,
+	/* ! */ 29,
+	/* " */ 87,
+	/* # */ 139,
+	/* $ */ 231,
+	/* % */ 335,
+	/* & */ 415,
+	/* ' */ 507,
+	/* ( */ 547,
+	/* ) */ 611,
+	/* * */ 675,
+	/* + */ 747,
+	/* , */ 803,
+	/* - */ 847,
+	/* . */ 879,
+	/* / */ 915,
+	/* 0 */ 979,
+	/* 1 */ 1075,
+	/* 2 */ 1139,
+	/* 3 */ 1211,
+	/* 4 */ 1283,
+	/* 5 */ 1359,
+	/* 6 */ 1427,
+	/* 7 */ 1507,
+	/* 8 */ 1571,
+	/* 9 */ 1659,
+	/* : */ 1739,
+	/* ; */ 1783,
+	/* < */ 1835,
+	/* = */ 1899,
+	/* > */ 1935,
+	/* ? */ 1999,
+	/* @ */ 2067,
+	/* A */ 2183,
+	/* B */ 2267,
+	/* C */ 2355,
+	/* D */ 2427,
+	/* E */ 2519,
+	/* F */ 2583,
+	/* G */ 2647,
+	/* H */ 2727,
+	/* I */ 2823,
+	/* J */ 2887,
+	/* K */ 2955,
+	/* L */ 3047,
+	/* M */ 3111,
+	/* N */ 3233,
+	/* O */ 3353,
+	/* P */ 3445,
+	/* Q */ 3525,
+	/* R */ 3623,
+	/* S */ 3715,
+	/* T */ 3787,
+	/* U */ 3851,
+	/* V */ 3947,
+	/* W */ 4037,
+	/* X */ 4159,
+	/* Y */ 4251,
+	/* Z */ 4329,
+	/* [ */ 4393,
+	/* \ */ 4457,
+	/* ] */ 4521,
+	/* ^ */ 4585,
+	/* _ */ 4631,
+	/* ` */ 4663,
+	/* a */ 4703,
+	/* b */ 4773,
+	/* c */ 4865,
+	/* d */ 4929,
+	/* e */ 5021,
+	/* f */ 5085,
+	/* g */ 5153,
+	/* h */ 5247,
+	/* i */ 5341,
+	/* j */ 5405,
+	/* k */ 5485,
+	/* l */ 5577,
+	/* m */ 5645,
+	/* n */ 5753,
+	/* o */ 5835,
+	/* p */ 5911,
+	/* q */ 6003,
+	/* r */ 6095,
+	/* s */ 6153,
+	/* t */ 6217,
+	/* u */ 6287,
+	/* v */ 6369,
+	/* w */ 6445,
+	/* x */ 6547,
+	/* y */ 6623,
+	/* z */ 6719,
+	/* { */ 6775,
+	/* | */ 6839,
+	/* } */ 6903,
+	/* ~ */ 6967,
+};
+
+uint8_t const font_13_spans[] = {
+
+	/* height */ 13,
+
+	/*   */ 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ! */ 1, 0, 0, 2, 4, 6, 8, 10, 12, 12, 14, 16, 16, 16, 16, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* " */ 3, 0, 0, 4, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* # */ 5, 0, 0, 4, 8, 10, 14, 18, 22, 24, 28, 32, 32, 32, 32, 1, 1, 3, 1, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1, 1, 1, 3, 1,
+	/* $ */ 5, 0, 2, 4, 10, 14, 18, 20, 24, 28, 34, 36, 38, 38, 38, 2, 1, 1, 3, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 0, 1, 2, 1, 1, 3, 2, 1, 4, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 1, 3, 2, 1,
+	/* % */ 5, 0, 0, 4, 8, 10, 12, 14, 16, 18, 22, 26, 26, 26, 26, 0, 2, 4, 1, 0, 2, 4, 1, 3, 1, 3, 1, 2, 1, 1, 1, 1, 1, 0, 1, 3, 2, 0, 1, 3, 2,
+	/* & */ 5, 0, 0, 2, 6, 10, 12, 16, 20, 24, 28, 32, 32, 32, 32, 2, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1, 1, 2, 4, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2, 4, 1,
+	/* ' */ 1, 0, 0, 2, 4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 1, 0, 1, 0, 1,
+	/* ( */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 2, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1, 2, 1,
+	/* ) */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 0, 1,
+	/* * */ 5, 0, 0, 0, 0, 2, 8, 10, 12, 14, 20, 22, 22, 22, 22, 2, 1, 0, 1, 2, 1, 4, 1, 1, 3, 2, 1, 1, 3, 0, 1, 2, 1, 4, 1, 2, 1,
+	/* + */ 5, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 14, 14, 14, 2, 1, 2, 1, 2, 1, 0, 5, 2, 1, 2, 1, 2, 1,
+	/* , */ 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 0, 2, 0, 2, 1, 1, 0, 1,
+	/* - */ 5, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 5,
+	/* . */ 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 4, 0, 2, 0, 2,
+	/* / */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 4, 1, 4, 1, 3, 1, 3, 1, 2, 1, 1, 1, 1, 1, 0, 1, 0, 1,
+	/* 0 */ 5, 0, 0, 2, 6, 10, 14, 20, 24, 28, 32, 34, 34, 34, 34, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* 1 */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 1, 1, 1, 1, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* 2 */ 5, 0, 0, 2, 6, 10, 12, 14, 16, 18, 20, 22, 22, 22, 22, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 4, 1, 3, 1, 2, 1, 1, 1, 0, 1, 0, 5,
+	/* 3 */ 5, 0, 0, 2, 6, 8, 10, 12, 14, 16, 20, 22, 22, 22, 22, 1, 3, 0, 1, 4, 1, 4, 1, 4, 1, 1, 3, 4, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* 4 */ 5, 0, 0, 2, 4, 8, 12, 16, 18, 20, 22, 24, 24, 24, 24, 4, 1, 3, 2, 2, 1, 4, 1, 1, 1, 4, 1, 0, 1, 4, 1, 0, 5, 4, 1, 4, 1, 4, 1,
+	/* 5 */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 18, 20, 20, 20, 20, 0, 5, 0, 1, 0, 1, 0, 1, 0, 4, 4, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* 6 */ 5, 0, 0, 2, 6, 8, 10, 12, 16, 20, 24, 26, 26, 26, 26, 1, 3, 0, 1, 4, 1, 0, 1, 0, 1, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* 7 */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 5, 4, 1, 4, 1, 3, 1, 3, 1, 2, 1, 2, 1, 1, 1, 1, 1,
+	/* 8 */ 5, 0, 0, 2, 6, 10, 14, 16, 20, 24, 28, 30, 30, 30, 30, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* 9 */ 5, 0, 0, 2, 6, 10, 14, 16, 18, 20, 24, 26, 26, 26, 26, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4, 4, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* : */ 2, 0, 0, 0, 0, 2, 4, 4, 4, 4, 6, 8, 8, 8, 8, 0, 2, 0, 2, 0, 2, 0, 2,
+	/* ; */ 2, 0, 0, 0, 0, 2, 4, 4, 4, 4, 6, 8, 10, 12, 12, 0, 2, 0, 2, 0, 2, 0, 2, 1, 1, 0, 1,
+	/* < */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 4, 1, 3, 1, 2, 1, 1, 1, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1,
+	/* = */ 5, 0, 0, 0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 4, 4, 0, 5, 0, 5,
+	/* > */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 3, 1, 2, 1, 1, 1, 0, 1,
+	/* ? */ 5, 0, 0, 2, 6, 10, 12, 14, 16, 16, 18, 20, 20, 20, 20, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 4, 1, 3, 1, 2, 1, 2, 1, 2, 1,
+	/* @ */ 7, 0, 0, 2, 6, 12, 20, 28, 36, 40, 42, 44, 44, 44, 44, 1, 5, 0, 1, 6, 1, 0, 1, 2, 3, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 2, 4, 0, 1, 1, 5,
+	/* A */ 5, 0, 0, 2, 4, 8, 12, 16, 20, 22, 26, 30, 30, 30, 30, 2, 1, 2, 1, 1, 1, 3, 1, 1, 1, 3, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 5, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* B */ 5, 0, 0, 2, 6, 10, 14, 16, 20, 24, 28, 30, 30, 30, 30, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4,
+	/* C */ 5, 0, 0, 2, 6, 8, 10, 12, 14, 16, 20, 22, 22, 22, 22, 1, 3, 0, 1, 4, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 1, 1, 3,
+	/* D */ 5, 0, 0, 2, 6, 10, 14, 18, 22, 26, 30, 32, 32, 32, 32, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4,
+	/* E */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 5, 0, 1, 0, 1, 0, 1, 0, 4, 0, 1, 0, 1, 0, 1, 0, 5,
+	/* F */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 5, 0, 1, 0, 1, 0, 1, 0, 4, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* G */ 5, 0, 0, 2, 6, 8, 10, 12, 16, 20, 24, 26, 26, 26, 26, 1, 3, 0, 1, 4, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 3, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* H */ 5, 0, 0, 4, 8, 12, 16, 18, 22, 26, 30, 34, 34, 34, 34, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 5, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* I */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* J */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 18, 20, 20, 20, 20, 1, 4, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* K */ 5, 0, 0, 4, 8, 12, 16, 18, 22, 26, 30, 34, 34, 34, 34, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 3, 1, 0, 1, 2, 1, 0, 2, 0, 1, 2, 1, 0, 1, 3, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* L */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 5,
+	/* M */ 7, 0, 0, 4, 8, 16, 24, 30, 34, 38, 42, 46, 46, 46, 46, 0, 1, 6, 1, 0, 2, 5, 2, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 6, 1, 0, 1, 6, 1, 0, 1, 6, 1, 0, 1, 6, 1,
+	/* N */ 5, 0, 0, 4, 8, 12, 18, 24, 30, 34, 38, 42, 42, 42, 42, 0, 1, 4, 1, 0, 2, 4, 1, 0, 2, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 3, 2, 0, 1, 3, 2, 0, 1, 4, 1,
+	/* O */ 5, 0, 0, 2, 6, 10, 14, 18, 22, 26, 30, 32, 32, 32, 32, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* P */ 5, 0, 0, 2, 6, 10, 14, 18, 20, 22, 24, 26, 26, 26, 26, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4, 0, 1, 0, 1, 0, 1,
+	/* Q */ 5, 0, 0, 2, 6, 10, 14, 18, 22, 26, 32, 34, 36, 36, 36, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 2, 1, 4, 1, 1, 3, 4, 1,
+	/* R */ 5, 0, 0, 2, 6, 10, 14, 18, 20, 24, 28, 32, 32, 32, 32, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4, 0, 1, 2, 1, 0, 1, 3, 1, 0, 1, 4, 1,
+	/* S */ 5, 0, 0, 2, 6, 8, 10, 12, 14, 16, 20, 22, 22, 22, 22, 1, 3, 0, 1, 4, 1, 0, 1, 0, 1, 1, 3, 4, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* T */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 5, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+	/* U */ 5, 0, 0, 4, 8, 12, 16, 20, 24, 28, 32, 34, 34, 34, 34, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* V */ 5, 0, 0, 4, 8, 12, 16, 20, 24, 28, 30, 32, 32, 32, 32, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1, 2, 1,
+	/* W */ 7, 0, 0, 4, 8, 12, 16, 22, 30, 38, 42, 46, 46, 46, 46, 0, 1, 6, 1, 0, 1, 6, 1, 0, 1, 6, 1, 0, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 1, 2, 1, 4, 1, 6, 1, 0, 2, 5, 2, 0, 1, 6, 1,
+	/* X */ 5, 0, 0, 4, 8, 12, 16, 18, 22, 26, 30, 34, 34, 34, 34, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1, 1, 1, 3, 1, 1, 1, 3, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* Y */ 5, 0, 0, 4, 8, 12, 16, 18, 20, 22, 24, 26, 26, 26, 26, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+	/* Z */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 5, 4, 1, 3, 1, 3, 1, 2, 1, 1, 1, 1, 1, 0, 1, 0, 5,
+	/* [ */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 3, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3,
+	/* \ */ 5, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 1, 0, 1, 1, 1, 1, 1, 2, 1, 3, 1, 3, 1, 4, 1, 4, 1,
+	/* ] */ 3, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 3, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 0, 3,
+	/* ^ */ 5, 0, 0, 2, 6, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 2, 1, 1, 1, 3, 1, 0, 1, 4, 1,
+	/* _ */ 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 5,
+	/* ` */ 3, 0, 0, 2, 4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 1, 1, 1, 2, 1,
+	/* a */ 5, 0, 0, 0, 0, 2, 4, 6, 8, 12, 16, 18, 18, 18, 18, 1, 3, 4, 1, 4, 1, 1, 4, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4,
+	/* b */ 5, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 30, 30, 30, 30, 0, 1, 0, 1, 0, 1, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4,
+	/* c */ 5, 0, 0, 0, 0, 2, 6, 8, 10, 12, 16, 18, 18, 18, 18, 1, 3, 0, 1, 4, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 1, 1, 3,
+	/* d */ 5, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 30, 30, 30, 30, 4, 1, 4, 1, 4, 1, 1, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4,
+	/* e */ 5, 0, 0, 0, 0, 2, 6, 10, 12, 14, 16, 18, 18, 18, 18, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 5, 0, 1, 0, 1, 1, 3,
+	/* f */ 5, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 20, 20, 20, 2, 3, 1, 1, 1, 1, 1, 1, 0, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* g */ 5, 0, 0, 0, 0, 2, 6, 10, 14, 18, 22, 24, 26, 28, 30, 1, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4, 4, 1, 4, 1, 0, 4,
+	/* h */ 5, 0, 2, 4, 6, 8, 12, 16, 20, 24, 28, 32, 32, 32, 32, 0, 1, 0, 1, 0, 1, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* i */ 3, 0, 2, 4, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 1, 1, 1, 1, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* j */ 4, 0, 2, 4, 4, 6, 8, 10, 12, 14, 16, 18, 20, 24, 26, 3, 1, 3, 1, 2, 2, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* k */ 5, 0, 2, 4, 6, 10, 14, 18, 20, 24, 28, 32, 32, 32, 32, 0, 1, 0, 1, 0, 1, 0, 1, 4, 1, 0, 1, 3, 1, 0, 1, 2, 1, 0, 2, 0, 1, 2, 1, 0, 1, 3, 1, 0, 1, 4, 1,
+	/* l */ 5, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 20, 20, 20, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 3,
+	/* m */ 7, 0, 0, 0, 0, 4, 10, 16, 22, 28, 34, 40, 40, 40, 40, 0, 3, 4, 2, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1,
+	/* n */ 5, 0, 0, 0, 0, 2, 6, 10, 14, 18, 22, 26, 26, 26, 26, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* o */ 5, 0, 0, 0, 0, 2, 6, 10, 14, 18, 22, 24, 24, 24, 24, 1, 3, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 3,
+	/* p */ 5, 0, 0, 0, 0, 2, 6, 10, 14, 18, 22, 24, 26, 28, 30, 0, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 4, 0, 1, 0, 1, 0, 1,
+	/* q */ 5, 0, 0, 0, 0, 2, 6, 10, 14, 18, 22, 24, 26, 28, 30, 1, 4, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4, 4, 1, 4, 1, 4, 1,
+	/* r */ 5, 0, 0, 0, 0, 4, 6, 8, 10, 12, 14, 16, 16, 16, 16, 0, 1, 2, 3, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* s */ 5, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 14, 14, 14, 1, 4, 0, 1, 0, 1, 1, 3, 4, 1, 4, 1, 0, 4,
+	/* t */ 5, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 20, 20, 20, 1, 1, 1, 1, 1, 1, 0, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3,
+	/* u */ 5, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 26, 26, 26, 26, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4,
+	/* v */ 5, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 26, 26, 26, 26, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1,
+	/* w */ 7, 0, 0, 0, 0, 4, 10, 16, 22, 28, 34, 38, 38, 38, 38, 0, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 0, 1, 3, 1, 6, 1, 1, 2, 4, 2,
+	/* x */ 5, 0, 0, 0, 0, 4, 8, 12, 14, 18, 22, 26, 26, 26, 26, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 2, 1, 1, 1, 3, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* y */ 5, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 26, 28, 30, 32, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 4, 4, 1, 4, 1, 0, 4,
+	/* z */ 5, 0, 0, 0, 0, 2, 4, 6, 8, 10, 12, 14, 14, 14, 14, 0, 5, 4, 1, 3, 1, 2, 1, 1, 1, 0, 1, 0, 5,
+	/* { */ 4, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 2, 2, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+	/* | */ 1, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* } */ 4, 0, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 18, 18, 18, 0, 2, 2, 1, 2, 1, 2, 1, 3, 1, 2, 1, 2, 1, 2, 1, 0, 2,
+	/* ~ */ 5, 0, 0, 0, 0, 0, 4, 10, 14, 14, 14, 14, 14, 14, 14, 1, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 3, 1,
+};
+
+uint16_t const font_13_spans_index[] = {
+	/*   */ 1,
+	/* ! */ 16,
+	/* " */ 47,
+	/* # */ 74,
+	/* $ */ 121,
+	/* % */ 174,
+	/* & */ 215,
+	/* ' */ 262,
+	/* ( */ 283,
+	/* ) */ 316,
+	/* * */ 349,
+	/* + */ 386,
+	/* , */ 415,
+	/* - */ 438,
+	/* . */ 455,
+	/* / */ 474,
+	/* 0 */ 507,
+	/* 1 */ 556,
+	/* 2 */ 589,
+	/* 3 */ 626,
+	/* 4 */ 663,
+	/* 5 */ 702,
+	/* 6 */ 737,
+	/* 7 */ 778,
+	/* 8 */ 811,
+	/* 9 */ 856,
+	/* : */ 897,
+	/* ; */ 920,
+	/* < */ 947,
+	/* = */ 980,
+	/* > */ 999,
+	/* ? */ 1032,
+	/* @ */ 1067,
+	/* A */ 1126,
+	/* B */ 1171,
+	/* C */ 1216,
+	/* D */ 1253,
+	/* E */ 1300,
+	/* F */ 1333,
+	/* G */ 1366,
+	/* H */ 1407,
+	/* I */ 1456,
+	/* J */ 1489,
+	/* K */ 1524,
+	/* L */ 1573,
+	/* M */ 1606,
+	/* N */ 1667,
+	/* O */ 1724,
+	/* P */ 1771,
+	/* Q */ 1812,
+	/* R */ 1863,
+	/* S */ 1910,
+	/* T */ 1947,
+	/* U */ 1980,
+	/* V */ 2029,
+	/* W */ 2076,
+	/* X */ 2137,
+	/* Y */ 2186,
+	/* Z */ 2227,
+	/* [ */ 2260,
+	/* \ */ 2293,
+	/* ] */ 2326,
+	/* ^ */ 2359,
+	/* _ */ 2384,
+	/* ` */ 2401,
+	/* a */ 2422,
+	/* b */ 2455,
+	/* c */ 2500,
+	/* d */ 2533,
+	/* e */ 2578,
+	/* f */ 2611,
+	/* g */ 2646,
+	/* h */ 2691,
+	/* i */ 2738,
+	/* j */ 2771,
+	/* k */ 2812,
+	/* l */ 2859,
+	/* m */ 2894,
+	/* n */ 2949,
+	/* o */ 2990,
+	/* p */ 3029,
+	/* q */ 3074,
+	/* r */ 3119,
+	/* s */ 3150,
+	/* t */ 3179,
+	/* u */ 3214,
+	/* v */ 3255,
+	/* w */ 3296,
+	/* x */ 3349,
+	/* y */ 3390,
+	/* z */ 3437,
+	/* { */ 3466,
+	/* | */ 3499,
+	/* } */ 3532,
+	/* ~ */ 3565,
+};
+
+uint8_t const font_7_spans[] = {
+
+	/* height */ 7,
+
+	/*   */ 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ! */ 1, 0, 2, 4, 6, 6, 8, 8, 8, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* " */ 3, 0, 4, 8, 8, 8, 8, 8, 8, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* # */ 5, 0, 4, 6, 10, 12, 16, 16, 16, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1,
+	/* $ */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 1, 1, 0, 3, 0, 2, 1, 2, 0, 3, 1, 1,
+	/* % */ 3, 0, 4, 6, 8, 10, 14, 14, 14, 0, 1, 2, 1, 2, 1, 1, 1, 0, 1, 0, 1, 2, 1,
+	/* & */ 3, 0, 2, 6, 8, 12, 14, 14, 14, 1, 1, 0, 1, 2, 1, 1, 1, 0, 1, 2, 1, 1, 2,
+	/* ' */ 1, 0, 2, 4, 4, 4, 4, 4, 4, 0, 1, 0, 1,
+	/* ( */ 2, 0, 2, 4, 6, 8, 10, 10, 10, 1, 1, 0, 1, 0, 1, 0, 1, 1, 1,
+	/* ) */ 2, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+	/* * */ 2, 0, 2, 4, 4, 4, 4, 4, 4, 0, 2, 0, 2,
+	/* + */ 3, 0, 0, 2, 4, 6, 6, 6, 6, 1, 1, 0, 3, 1, 1,
+	/* , */ 1, 0, 0, 0, 0, 0, 2, 4, 4, 0, 1, 0, 1,
+	/* - */ 3, 0, 0, 0, 2, 2, 2, 2, 2, 0, 3,
+	/* . */ 1, 0, 0, 0, 0, 0, 2, 2, 2, 0, 1,
+	/* / */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 2, 1, 2, 1, 1, 1, 1, 1, 0, 1, 0, 1,
+	/* 0 */ 3, 0, 2, 6, 10, 14, 16, 16, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* 1 */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 1, 1, 0, 2, 1, 1, 1, 1, 0, 3,
+	/* 2 */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 2, 1, 0, 3, 0, 1, 0, 3,
+	/* 3 */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 2, 1, 0, 3, 2, 1, 0, 3,
+	/* 4 */ 3, 0, 4, 8, 10, 12, 14, 14, 14, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 2, 1, 2, 1,
+	/* 5 */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 0, 1, 0, 3, 2, 1, 0, 3,
+	/* 6 */ 3, 0, 2, 4, 6, 10, 12, 12, 12, 0, 3, 0, 1, 0, 3, 0, 1, 2, 1, 0, 3,
+	/* 7 */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 2, 1, 2, 1, 2, 1, 2, 1,
+	/* 8 */ 3, 0, 2, 6, 8, 12, 14, 14, 14, 0, 3, 0, 1, 2, 1, 0, 3, 0, 1, 2, 1, 0, 3,
+	/* 9 */ 3, 0, 2, 6, 8, 10, 12, 12, 12, 0, 3, 0, 1, 2, 1, 0, 3, 2, 1, 0, 3,
+	/* : */ 1, 0, 0, 2, 2, 2, 4, 4, 4, 0, 1, 0, 1,
+	/* ; */ 1, 0, 0, 2, 2, 2, 4, 6, 6, 0, 1, 0, 1, 0, 1,
+	/* < */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 2, 1, 1, 1, 0, 1, 1, 1, 2, 1,
+	/* = */ 3, 0, 0, 2, 2, 4, 4, 4, 4, 0, 3, 0, 3,
+	/* > */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 1, 1, 2, 1, 1, 1, 0, 1,
+	/* ? */ 3, 0, 2, 4, 6, 6, 8, 8, 8, 0, 3, 2, 1, 1, 1, 1, 1,
+	/* @ */ 4, 0, 2, 6, 10, 14, 16, 18, 18, 0, 4, 0, 1, 3, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 0, 4,
+	/* A */ 3, 0, 2, 6, 10, 12, 16, 16, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 0, 1, 2, 1,
+	/* B */ 3, 0, 2, 6, 8, 12, 14, 14, 14, 0, 2, 0, 1, 2, 1, 0, 2, 0, 1, 2, 1, 0, 2,
+	/* C */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 0, 1, 0, 1, 0, 1, 0, 3,
+	/* D */ 3, 0, 2, 6, 10, 14, 16, 16, 16, 0, 2, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 2,
+	/* E */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 0, 1, 0, 3, 0, 1, 0, 3,
+	/* F */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 0, 1, 0, 3, 0, 1, 0, 1,
+	/* G */ 3, 0, 2, 4, 6, 10, 12, 12, 12, 0, 3, 0, 1, 0, 1, 0, 1, 2, 1, 0, 3,
+	/* H */ 3, 0, 4, 8, 10, 14, 18, 18, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* I */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* J */ 3, 0, 2, 4, 6, 10, 12, 12, 12, 2, 1, 2, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* K */ 3, 0, 4, 8, 10, 14, 18, 18, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 2, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* L */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3,
+	/* M */ 5, 0, 4, 8, 14, 18, 22, 22, 22, 0, 1, 4, 1, 0, 2, 3, 2, 0, 1, 2, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* N */ 4, 0, 4, 8, 10, 14, 18, 18, 18, 0, 1, 3, 1, 0, 2, 3, 1, 0, 4, 0, 1, 2, 2, 0, 1, 3, 1,
+	/* O */ 3, 0, 2, 6, 10, 14, 16, 16, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* P */ 3, 0, 2, 6, 8, 10, 12, 12, 12, 0, 3, 0, 1, 2, 1, 0, 3, 0, 1, 0, 1,
+	/* Q */ 3, 0, 2, 6, 10, 12, 14, 16, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 0, 3, 2, 1,
+	/* R */ 3, 0, 2, 6, 8, 12, 16, 16, 16, 0, 3, 0, 1, 2, 1, 0, 2, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* S */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 0, 1, 1, 1, 2, 1, 0, 3,
+	/* T */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* U */ 3, 0, 4, 8, 12, 16, 18, 18, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* V */ 3, 0, 4, 8, 12, 16, 18, 18, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 1, 1,
+	/* W */ 5, 0, 4, 8, 14, 18, 22, 22, 22, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 2, 3, 2, 0, 1, 4, 1,
+	/* X */ 3, 0, 4, 8, 10, 14, 18, 18, 18, 0, 1, 2, 1, 0, 1, 2, 1, 1, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* Y */ 3, 0, 4, 8, 10, 12, 14, 14, 14, 0, 1, 2, 1, 0, 1, 2, 1, 1, 1, 1, 1, 1, 1,
+	/* Z */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 3, 2, 1, 1, 1, 0, 1, 0, 3,
+	/* [ */ 2, 0, 2, 4, 6, 8, 10, 10, 10, 0, 2, 0, 1, 0, 1, 0, 1, 0, 2,
+	/* \ */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 0, 1, 0, 1, 1, 1, 1, 1, 2, 1, 2, 1,
+	/* ] */ 2, 0, 2, 4, 6, 8, 10, 10, 10, 0, 2, 1, 1, 1, 1, 1, 1, 0, 2,
+	/* ^ */ 3, 0, 2, 6, 6, 6, 6, 6, 6, 1, 1, 0, 1, 2, 1,
+	/* _ */ 3, 0, 0, 0, 0, 0, 0, 2, 2, 0, 3,
+	/* ` */ 3, 0, 2, 4, 6, 6, 6, 6, 6, 0, 1, 1, 1, 2, 1,
+	/* a */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 2, 1, 0, 3, 0, 3,
+	/* b */ 3, 0, 2, 4, 8, 12, 14, 14, 14, 0, 1, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* c */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 0, 1, 0, 1, 0, 3,
+	/* d */ 3, 0, 2, 4, 8, 12, 14, 14, 14, 2, 1, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* e */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 0, 3, 0, 1, 0, 3,
+	/* f */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 1, 2, 1, 1, 0, 3, 1, 1, 1, 1,
+	/* g */ 3, 0, 0, 2, 6, 10, 12, 14, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 2, 1, 0, 3,
+	/* h */ 3, 0, 2, 4, 8, 12, 16, 16, 16, 0, 1, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* i */ 1, 0, 2, 2, 4, 6, 8, 8, 8, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* j */ 2, 0, 2, 2, 4, 6, 8, 10, 12, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2,
+	/* k */ 3, 0, 2, 6, 8, 10, 14, 14, 14, 0, 1, 0, 1, 2, 1, 0, 2, 0, 2, 0, 1, 2, 1,
+	/* l */ 2, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2,
+	/* m */ 5, 0, 0, 2, 8, 14, 20, 20, 20, 0, 5, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1,
+	/* n */ 3, 0, 0, 2, 6, 10, 14, 14, 14, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* o */ 3, 0, 0, 2, 6, 10, 12, 12, 12, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* p */ 3, 0, 0, 2, 6, 10, 12, 14, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 0, 1, 0, 1,
+	/* q */ 3, 0, 0, 2, 6, 10, 12, 14, 16, 0, 3, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 2, 1, 2, 1,
+	/* r */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 0, 1, 0, 1, 0, 1,
+	/* s */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 0, 1, 2, 1, 0, 3,
+	/* t */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 1, 1, 0, 3, 1, 1, 1, 1, 1, 2,
+	/* u */ 3, 0, 0, 4, 8, 12, 14, 14, 14, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3,
+	/* v */ 3, 0, 0, 4, 8, 12, 14, 14, 14, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 1, 1,
+	/* w */ 5, 0, 0, 6, 12, 18, 20, 20, 20, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 5,
+	/* x */ 3, 0, 0, 4, 6, 8, 12, 12, 12, 0, 1, 2, 1, 1, 1, 1, 1, 0, 1, 2, 1,
+	/* y */ 3, 0, 0, 4, 8, 12, 14, 16, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 3, 2, 1, 0, 3,
+	/* z */ 3, 0, 0, 2, 4, 6, 8, 8, 8, 0, 3, 2, 1, 0, 1, 0, 3,
+	/* { */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 1, 2, 1, 1, 0, 2, 1, 1, 1, 2,
+	/* | */ 1, 0, 2, 4, 6, 8, 10, 12, 12, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* } */ 3, 0, 2, 4, 6, 8, 10, 10, 10, 0, 2, 1, 1, 1, 2, 1, 1, 0, 2,
+	/* ~ */ 4, 0, 0, 0, 2, 4, 4, 4, 4, 0, 2, 2, 2,
+};
+
+uint16_t const font_7_spans_index[] = {
+	/*   */ 1,
+	/* ! */ 10,
+	/* " */ 27,
+	/* # */ 44,
+	/* $ */ 69,
+	/* % */ 90,
+	/* & */ 113,
+	/* ' */ 136,
+	/* ( */ 149,
+	/* ) */ 168,
+	/* * */ 187,
+	/* + */ 200,
+	/* , */ 215,
+	/* - */ 228,
+	/* . */ 239,
+	/* / */ 250,
+	/* 0 */ 271,
+	/* 1 */ 296,
+	/* 2 */ 315,
+	/* 3 */ 334,
+	/* 4 */ 353,
+	/* 5 */ 376,
+	/* 6 */ 395,
+	/* 7 */ 416,
+	/* 8 */ 435,
+	/* 9 */ 458,
+	/* : */ 479,
+	/* ; */ 492,
+	/* < */ 507,
+	/* = */ 526,
+	/* > */ 539,
+	/* ? */ 558,
+	/* @ */ 575,
+	/* A */ 602,
+	/* B */ 627,
+	/* C */ 650,
+	/* D */ 669,
+	/* E */ 694,
+	/* F */ 713,
+	/* G */ 732,
+	/* H */ 753,
+	/* I */ 780,
+	/* J */ 799,
+	/* K */ 820,
+	/* L */ 847,
+	/* M */ 866,
+	/* N */ 897,
+	/* O */ 924,
+	/* P */ 949,
+	/* Q */ 970,
+	/* R */ 995,
+	/* S */ 1020,
+	/* T */ 1039,
+	/* U */ 1058,
+	/* V */ 1085,
+	/* W */ 1112,
+	/* X */ 1143,
+	/* Y */ 1170,
+	/* Z */ 1193,
+	/* [ */ 1212,
+	/* \ */ 1231,
+	/* ] */ 1252,
+	/* ^ */ 1271,
+	/* _ */ 1286,
+	/* ` */ 1297,
+	/* a */ 1312,
+	/* b */ 1329,
+	/* c */ 1352,
+	/* d */ 1369,
+	/* e */ 1392,
+	/* f */ 1409,
+	/* g */ 1428,
+	/* h */ 1453,
+	/* i */ 1478,
+	/* j */ 1495,
+	/* k */ 1516,
+	/* l */ 1539,
+	/* m */ 1558,
+	/* n */ 1587,
+	/* o */ 1610,
+	/* p */ 1631,
+	/* q */ 1656,
+	/* r */ 1681,
+	/* s */ 1698,
+	/* t */ 1715,
+	/* u */ 1734,
+	/* v */ 1757,
+	/* w */ 1780,
+	/* x */ 1809,
+	/* y */ 1830,
+	/* z */ 1857,
+	/* { */ 1874,
+	/* | */ 1893,
+	/* } */ 1914,
+	/* ~ */ 1933,
+};
+
+uint8_t const font_8_spans[] = {
+
+	/* height */ 8,
+
+	/*   */ 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ! */ 1, 0, 2, 4, 6, 8, 8, 10, 10, 10, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* " */ 3, 0, 4, 8, 12, 12, 12, 12, 12, 12, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+	/* # */ 5, 0, 0, 4, 6, 10, 12, 16, 16, 16, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1, 0, 5, 1, 1, 3, 1,
+	/* $ */ 5, 0, 2, 4, 8, 10, 14, 16, 18, 18, 2, 1, 1, 4, 0, 1, 2, 1, 1, 3, 2, 1, 4, 1, 0, 4, 2, 1,
+	/* % */ 4, 0, 0, 0, 4, 6, 8, 12, 12, 12, 0, 1, 3, 1, 2, 1, 1, 1, 0, 1, 3, 1,
+	/* & */ 4, 0, 2, 6, 8, 12, 16, 18, 18, 18, 1, 1, 0, 1, 2, 1, 1, 1, 0, 1, 2, 2, 0, 1, 2, 1, 1, 3,
+	/* ' */ 1, 0, 2, 4, 6, 6, 6, 6, 6, 6, 0, 1, 0, 1, 0, 1,
+	/* ( */ 2, 0, 2, 4, 6, 8, 10, 12, 14, 14, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1,
+	/* ) */ 2, 0, 2, 4, 6, 8, 10, 12, 14, 14, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+	/* * */ 5, 0, 0, 2, 8, 10, 16, 18, 18, 18, 2, 1, 0, 1, 2, 1, 4, 1, 1, 3, 0, 1, 2, 1, 4, 1, 2, 1,
+	/* + */ 5, 0, 0, 2, 4, 6, 8, 10, 10, 10, 2, 1, 2, 1, 0, 5, 2, 1, 2, 1,
+	/* , */ 2, 0, 0, 0, 0, 0, 0, 2, 4, 4, 1, 1, 0, 1,
+	/* - */ 4, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 4,
+	/* . */ 1, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 1,
+	/* / */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 2, 1, 2, 1, 1, 1, 1, 1, 0, 1, 0, 1,
+	/* 0 */ 4, 0, 2, 6, 10, 14, 18, 20, 20, 20, 1, 2, 0, 1, 3, 1, 0, 1, 2, 2, 0, 2, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* 1 */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 1, 0, 2, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* 2 */ 4, 0, 2, 6, 8, 10, 12, 14, 14, 14, 1, 2, 0, 1, 3, 1, 3, 1, 2, 1, 1, 1, 0, 4,
+	/* 3 */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 3, 3, 1, 1, 3, 3, 1, 3, 1, 0, 3,
+	/* 4 */ 4, 0, 2, 6, 10, 12, 14, 16, 16, 16, 2, 2, 1, 1, 3, 1, 0, 1, 3, 1, 0, 4, 3, 1, 3, 1,
+	/* 5 */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 4, 0, 1, 0, 3, 3, 1, 3, 1, 0, 3,
+	/* 6 */ 4, 0, 2, 4, 6, 10, 14, 16, 16, 16, 1, 2, 0, 1, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* 7 */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 4, 3, 1, 2, 1, 2, 1, 1, 1, 1, 1,
+	/* 8 */ 4, 0, 2, 6, 8, 12, 16, 18, 18, 18, 1, 2, 0, 1, 3, 1, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* 9 */ 4, 0, 2, 6, 10, 12, 14, 16, 16, 16, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3, 3, 1, 1, 2,
+	/* : */ 1, 0, 0, 0, 2, 2, 2, 4, 4, 4, 0, 1, 0, 1,
+	/* ; */ 2, 0, 0, 0, 2, 2, 2, 4, 6, 6, 1, 1, 1, 1, 0, 1,
+	/* < */ 3, 0, 0, 2, 4, 6, 8, 10, 10, 10, 2, 1, 1, 1, 0, 1, 1, 1, 2, 1,
+	/* = */ 4, 0, 0, 0, 2, 2, 4, 4, 4, 4, 0, 4, 0, 4,
+	/* > */ 3, 0, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 1, 1, 2, 1, 1, 1, 0, 1,
+	/* ? */ 3, 0, 2, 6, 8, 10, 10, 12, 12, 12, 1, 1, 0, 1, 2, 1, 2, 1, 1, 1, 1, 1,
+	/* @ */ 5, 0, 0, 2, 6, 10, 14, 16, 18, 18, 1, 3, 0, 1, 4, 1, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 1, 3,
+	/* A */ 4, 0, 2, 6, 10, 12, 16, 20, 20, 20, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 0, 4, 0, 1, 3, 1, 0, 1, 3, 1,
+	/* B */ 4, 0, 2, 6, 8, 12, 16, 18, 18, 18, 0, 3, 0, 1, 3, 1, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3,
+	/* C */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 3, 0, 1, 0, 1, 0, 1, 0, 1, 1, 3,
+	/* D */ 4, 0, 2, 6, 10, 14, 18, 20, 20, 20, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3,
+	/* E */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 4, 0, 1, 0, 3, 0, 1, 0, 1, 0, 4,
+	/* F */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 4, 0, 1, 0, 1, 0, 3, 0, 1, 0, 1,
+	/* G */ 4, 0, 2, 4, 6, 10, 14, 16, 16, 16, 1, 3, 0, 1, 0, 1, 0, 1, 2, 2, 0, 1, 3, 1, 1, 3,
+	/* H */ 4, 0, 4, 8, 12, 14, 18, 22, 22, 22, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 4, 0, 1, 3, 1, 0, 1, 3, 1,
+	/* I */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* J */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 3, 2, 1, 2, 1, 2, 1, 2, 1, 0, 2,
+	/* K */ 4, 0, 4, 8, 10, 12, 16, 20, 20, 20, 0, 1, 3, 1, 0, 1, 2, 1, 0, 2, 0, 2, 0, 1, 2, 1, 0, 1, 3, 1,
+	/* L */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 4,
+	/* M */ 5, 0, 4, 8, 14, 18, 22, 26, 26, 26, 0, 1, 4, 1, 0, 2, 3, 2, 0, 1, 2, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1,
+	/* N */ 4, 0, 4, 8, 12, 16, 20, 24, 24, 24, 0, 1, 3, 1, 0, 2, 3, 1, 0, 2, 3, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 3, 1,
+	/* O */ 4, 0, 2, 6, 10, 14, 18, 20, 20, 20, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* P */ 4, 0, 2, 6, 10, 12, 14, 16, 16, 16, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3, 0, 1, 0, 1,
+	/* Q */ 4, 0, 2, 6, 10, 14, 18, 20, 20, 20, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 2, 2, 1, 3,
+	/* R */ 4, 0, 2, 6, 10, 12, 16, 20, 20, 20, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3, 0, 1, 2, 1, 0, 1, 3, 1,
+	/* S */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 3, 0, 1, 1, 1, 2, 1, 3, 1, 0, 3,
+	/* T */ 5, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 5, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+	/* U */ 4, 0, 4, 8, 12, 16, 20, 22, 22, 22, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* V */ 5, 0, 4, 8, 12, 16, 20, 22, 22, 22, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 1, 1, 3, 1, 2, 1,
+	/* W */ 5, 0, 4, 8, 12, 18, 24, 28, 28, 28, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 1, 1, 3, 1,
+	/* X */ 4, 0, 4, 8, 10, 12, 16, 20, 20, 20, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1,
+	/* Y */ 4, 0, 4, 8, 12, 14, 16, 18, 18, 18, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2, 1, 1, 0, 1,
+	/* Z */ 4, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 4, 3, 1, 2, 1, 1, 1, 0, 1, 0, 4,
+	/* [ */ 2, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2,
+	/* \ */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 1, 0, 1, 1, 1, 1, 1, 2, 1, 2, 1,
+	/* ] */ 2, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2,
+	/* ^ */ 3, 0, 2, 6, 6, 6, 6, 6, 6, 6, 1, 1, 0, 1, 2, 1,
+	/* _ */ 3, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 3,
+	/* ` */ 2, 0, 2, 4, 4, 4, 4, 4, 4, 4, 0, 1, 1, 1,
+	/* a */ 4, 0, 0, 0, 2, 6, 10, 12, 12, 12, 1, 3, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3,
+	/* b */ 4, 0, 2, 4, 6, 10, 14, 16, 16, 16, 0, 1, 0, 1, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3,
+	/* c */ 4, 0, 0, 0, 2, 4, 6, 8, 8, 8, 1, 3, 0, 1, 0, 1, 1, 3,
+	/* d */ 4, 0, 2, 4, 6, 10, 14, 16, 16, 16, 3, 1, 3, 1, 1, 3, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3,
+	/* e */ 4, 0, 0, 0, 2, 4, 6, 8, 8, 8, 1, 2, 0, 4, 0, 1, 1, 2,
+	/* f */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 2, 0, 1, 0, 1, 0, 2, 0, 1, 0, 1,
+	/* g */ 4, 0, 0, 0, 2, 6, 10, 12, 14, 16, 1, 3, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3, 3, 1, 1, 2,
+	/* h */ 4, 0, 2, 4, 6, 10, 14, 18, 18, 18, 0, 1, 0, 1, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1,
+	/* i */ 3, 0, 2, 2, 4, 6, 8, 10, 10, 10, 1, 1, 0, 2, 1, 1, 1, 1, 1, 2,
+	/* j */ 3, 0, 2, 2, 4, 6, 8, 10, 12, 14, 1, 1, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+	/* k */ 4, 0, 2, 4, 8, 12, 14, 18, 18, 18, 0, 1, 0, 1, 0, 1, 3, 1, 0, 1, 2, 1, 0, 3, 0, 1, 3, 1,
+	/* l */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3,
+	/* m */ 5, 0, 0, 0, 2, 8, 14, 20, 20, 20, 0, 4, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1,
+	/* n */ 4, 0, 0, 0, 2, 6, 10, 14, 14, 14, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1,
+	/* o */ 4, 0, 0, 0, 2, 6, 10, 12, 12, 12, 1, 2, 0, 1, 3, 1, 0, 1, 3, 1, 1, 2,
+	/* p */ 4, 0, 0, 0, 2, 6, 10, 12, 14, 16, 0, 3, 0, 1, 3, 1, 0, 1, 3, 1, 0, 3, 0, 1, 0, 1,
+	/* q */ 4, 0, 0, 0, 2, 6, 10, 12, 14, 16, 1, 3, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3, 3, 1, 3, 1,
+	/* r */ 4, 0, 0, 0, 4, 6, 8, 10, 10, 10, 0, 1, 2, 2, 0, 2, 0, 1, 0, 1,
+	/* s */ 4, 0, 0, 0, 2, 4, 6, 8, 8, 8, 1, 3, 0, 2, 2, 2, 0, 3,
+	/* t */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 1, 0, 1, 0, 3, 0, 1, 0, 1, 1, 2,
+	/* u */ 4, 0, 0, 0, 4, 8, 12, 14, 14, 14, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3,
+	/* v */ 5, 0, 0, 0, 4, 8, 12, 14, 14, 14, 0, 1, 4, 1, 0, 1, 4, 1, 1, 1, 3, 1, 2, 1,
+	/* w */ 5, 0, 0, 0, 4, 10, 16, 20, 20, 20, 0, 1, 4, 1, 0, 1, 2, 1, 4, 1, 0, 1, 2, 1, 4, 1, 1, 1, 3, 1,
+	/* x */ 4, 0, 0, 0, 4, 6, 8, 12, 12, 12, 0, 1, 3, 1, 1, 2, 1, 2, 0, 1, 3, 1,
+	/* y */ 4, 0, 0, 0, 4, 8, 12, 14, 16, 18, 0, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 1, 3, 3, 1, 1, 2,
+	/* z */ 4, 0, 0, 0, 2, 4, 6, 8, 8, 8, 0, 4, 2, 1, 1, 1, 0, 4,
+	/* { */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 1, 2, 1, 1, 0, 2, 0, 2, 1, 1, 1, 2,
+	/* | */ 1, 0, 0, 2, 4, 6, 8, 10, 10, 10, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	/* } */ 3, 0, 2, 4, 6, 8, 10, 12, 12, 12, 0, 2, 1, 1, 1, 2, 1, 2, 1, 1, 0, 2,
+	/* ~ */ 5, 0, 0, 2, 8, 10, 10, 10, 10, 10, 1, 1, 0, 1, 2, 1, 4, 1, 3, 1,
+};
+
+uint16_t const font_8_spans_index[] = {
+	/*   */ 1,
+	/* ! */ 11,
+	/* " */ 31,
+	/* # */ 53,
+	/* $ */ 79,
+	/* % */ 107,
+	/* & */ 129,
+	/* ' */ 157,
+	/* ( */ 173,
+	/* ) */ 197,
+	/* * */ 221,
+	/* + */ 249,
+	/* , */ 269,
+	/* - */ 283,
+	/* . */ 295,
+	/* / */ 307,
+	/* 0 */ 329,
+	/* 1 */ 359,
+	/* 2 */ 381,
+	/* 3 */ 405,
+	/* 4 */ 427,
+	/* 5 */ 453,
+	/* 6 */ 475,
+	/* 7 */ 501,
+	/* 8 */ 523,
+	/* 9 */ 551,
+	/* : */ 577,
+	/* ; */ 591,
+	/* < */ 607,
+	/* = */ 627,
+	/* > */ 641,
+	/* ? */ 661,
+	/* @ */ 683,
+	/* A */ 711,
+	/* B */ 741,
+	/* C */ 769,
+	/* D */ 791,
+	/* E */ 821,
+	/* F */ 843,
+	/* G */ 865,
+	/* H */ 891,
+	/* I */ 923,
+	/* J */ 945,
+	/* K */ 967,
+	/* L */ 997,
+	/* M */ 1019,
+	/* N */ 1055,
+	/* O */ 1089,
+	/* P */ 1119,
+	/* Q */ 1145,
+	/* R */ 1175,
+	/* S */ 1205,
+	/* T */ 1227,
+	/* U */ 1249,
+	/* V */ 1281,
+	/* W */ 1313,
+	/* X */ 1351,
+	/* Y */ 1381,
+	/* Z */ 1409,
+	/* [ */ 1431,
+	/* \ */ 1453,
+	/* ] */ 1475,
+	/* ^ */ 1497,
+	/* _ */ 1513,
+	/* ` */ 1525,
+	/* a */ 1539,
+	/* b */ 1561,
+	/* c */ 1587,
+	/* d */ 1605,
+	/* e */ 1631,
+	/* f */ 1649,
+	/* g */ 1671,
+	/* h */ 1697,
+	/* i */ 1725,
+	/* j */ 1745,
+	/* k */ 1769,
+	/* l */ 1797,
+	/* m */ 1819,
+	/* n */ 1849,
+	/* o */ 1873,
+	/* p */ 1895,
+	/* q */ 1921,
+	/* r */ 1947,
+	/* s */ 1967,
+	/* t */ 1985,
+	/* u */ 2007,
+	/* v */ 2031,
+	/* w */ 2055,
+	/* x */ 2085,
+	/* y */ 2107,
+	/* z */ 2135,
+	/* { */ 2153,
+	/* | */ 2175,
+	/* } */ 2195,
+	/* ~ */ 2217,
+};
@@ -0,0 +1,10 @@
+extern uint8_t const font_50_spans[];
+extern uint16_t const font_50_spans_index[];
+extern uint8_t const font_26_spans[];
+extern uint16_t const font_26_spans_index[];
+extern uint8_t const font_13_spans[];
+extern uint16_t const font_13_spans_index[];
+extern uint8_t const font_7_spans[];
+extern uint16_t const font_7_spans_index[];
+extern uint8_t const font_8_spans[];
+extern uint16_t const font_8_spans_index[];
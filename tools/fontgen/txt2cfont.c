@@ -14,6 +14,7 @@ typedef struct glyph glyph_t;
 enum config {
 	GLYPH_MAX_SIZE = 128*64,
 	ASCII_FIRST = ' ',
+	ASCII_LAST = '~',
 };
 
 struct glyph {
@@ -34,6 +35,8 @@ struct {
 static char *flag_t = "uint8_t const";
 static char *flag_a;
 static char *flag_p = "";
+static char *flag_x = "uint16_t const";
+static int flag_s;
 
 static void
 fatal(char *fmt, ...)
@@ -51,7 +54,7 @@ fatal(char *fmt, ...)
 static int
 parse_name(char *s)
 {
-	if (ctx.ascii > '~')
+	if (ctx.ascii > ASCII_LAST)
 		fatal("more characters than print_able ascii");
 	if (s[0] == '\0' || s[1] != ':')
 		fatal("expected '%c:' (with '%c' any char)", '%', '%');
@@ -60,7 +63,7 @@ parse_name(char *s)
 	return s[0];
 }
 
-static void
+static size_t
 print_glyph(glyph_t *g)
 {
 	size_t sz;
@@ -72,6 +75,72 @@ print_glyph(glyph_t *g)
 	for (size_t i = 0; i < sz; i++)
 		printf(" 0x%02"PRIX8",", g->buf[i]);
 	printf("\n");
+
+	/* width byte and bitmap */
+	return 1 + sz;
+}
+
+static int
+glyph_bit(glyph_t *g, size_t x, size_t y)
+{
+	size_t i = y * g->width + x;
+
+	return g->buf[i / 8] >> (i % 8) & 1;
+}
+
+/*
+ * With -s, a glyph is its width, then height+1 offsets counted from the
+ * end of that table, then the (start, length) pairs of the runs of set
+ * bits of each row: row y has its pairs between offsets y and y+1.
+ */
+static size_t
+print_glyph_spans(glyph_t *g)
+{
+	uint8_t row[GLYPH_MAX_SIZE + 1], span[UINT8_MAX + 1];
+	size_t n, x, x0;
+
+	if (g->width > UINT8_MAX)
+		fatal("glyph '%c' too wide for spans", g->c);
+	n = 0;
+	for (size_t y = 0; y < g->height; y++) {
+		row[y] = n;
+		for (x = 0; x < g->width; x++) {
+			if (!glyph_bit(g, x, y))
+				continue;
+			for (x0 = x; x < g->width && glyph_bit(g, x, y); x++)
+				continue;
+			if (n + 2 > UINT8_MAX)
+				fatal("glyph '%c' has too many spans", g->c);
+			span[n++] = x0;
+			span[n++] = x - x0;
+		}
+	}
+	row[g->height] = n;
+
+	printf("\t/* %c */ %zd,", g->c, g->width);
+	for (size_t y = 0; y <= g->height; y++)
+		printf(" %"PRIu8",", row[y]);
+	for (size_t i = 0; i < n; i++)
+		printf(" %"PRIu8",", span[i]);
+	printf("\n");
+
+	return 1 + g->height + 1 + n;
+}
+
+/*
+ * The index holds, for every character, the offset of its width byte
+ * in the font array, so that a glyph is found without scanning.
+ */
+static void
+print_index(char *name, size_t *offset)
+{
+	printf("\n");
+	if (flag_a != NULL)
+		printf("%s\n", flag_a);
+	printf("%s %s_index[] = {\n", flag_x, name);
+	for (int c = ASCII_FIRST; c <= ASCII_LAST; c++)
+		printf("\t/* %c */ %zu,\n", c, offset[c - ASCII_FIRST]);
+	printf("};\n");
 }
 
 static void
@@ -191,7 +260,7 @@ static void
 txt2cfont(char *path)
 {
 	char buf[128];
-	size_t h;
+	size_t h, off, offset[ASCII_LAST - ASCII_FIRST + 1];
 
 	memset(&ctx, 0, sizeof ctx);
 	ctx.ascii = ASCII_FIRST;
@@ -202,18 +271,26 @@ txt2cfont(char *path)
 	printf("\n");
 	if (flag_a != NULL)
 		printf("%s\n", flag_a);
-	printf("%s %s[] = {\n", flag_t, font_name(buf, sizeof buf, path));
+	font_name(buf, sizeof buf, path);
+	if (flag_s)
+		strncat(buf, "_spans", sizeof buf - strlen(buf) - 1);
+	printf("%s %s[] = {\n", flag_t, buf);
+	off = 1;
 	for (glyph_t g; parse_glyph(&g); h = g.height) {
 		if (ctx.ascii == ASCII_FIRST)
 			printf("\n\t/* height */ %zu,\n\n", g.height);
 		else if (h != g.height)
 			fatal("glyph '%c' of different height", ctx.ascii);
-		print_glyph(&g);
+		if (off > UINT16_MAX)
+			fatal("glyph '%c' past the reach of the index", ctx.ascii);
+		offset[ctx.ascii - ASCII_FIRST] = off;
+		off += flag_s ? print_glyph_spans(&g) : print_glyph(&g);
 		ctx.ascii++;
 	}
-	if (ctx.ascii <= '~')
+	if (ctx.ascii <= ASCII_LAST)
 		fatal("missing characters, next should be '%c'", ctx.ascii);
 	printf("};\n");
+	print_index(buf, offset);
 }
 
 char const *arg0;
@@ -222,7 +299,8 @@ static void
 usage(void)
 {
 	fprintf(stderr, "usage: %s"
-	    " [-a attribute] [-i include] [-p prefix] [-t type] file\n",
+	    " [-s] [-a attribute] [-i include] [-p prefix] [-t type]"
+	    " [-x index-type] file\n",
 	    arg0);
 	exit(1);
 }
@@ -231,7 +309,7 @@ int
 main(int argc, char *argv[])
 {
 	arg0 = *argv;
-	for (int o; (o = getopt(argc, argv, "a:i:p:t:")) != -1;) {
+	for (int o; (o = getopt(argc, argv, "a:i:p:st:x:")) != -1;) {
 		switch (o) {
 		case 'a':
 			flag_a = optarg;
@@ -242,9 +320,15 @@ main(int argc, char *argv[])
 		case 'p':
 			flag_p = optarg;
 			break;
+		case 's':
+			flag_s = 1;
+			break;
 		case 't':
 			flag_t = optarg;
 			break;
+		case 'x':
+			flag_x = optarg;
+			break;
 		default:
 			usage();
 		}
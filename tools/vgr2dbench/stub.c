@@ -0,0 +1,100 @@
+/*
+ * Stand-in for the MicroPython runtime hooks used by vgr2dlib.c and
+ * vgr2dcmd.c, so they can be built and measured on the host.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "stub.h"
+
+stub_stats_t stub_stats;
+
+static uint8_t arena_mem[STUB_ARENA_SIZE];
+static vgr2d_arena_t arena;
+
+// Spilled blocks are kept on a list and freed at the end of the frame,
+// like the GC would eventually do on the glasses.
+typedef struct spill_s {
+  struct spill_s *next;
+} spill_t;
+
+static spill_t *spills;
+
+void stub_frame_begin(void) {
+  if (arena.mem == NULL)
+    vgr2d_arena_init(&arena, arena_mem, sizeof arena_mem);
+  vgr2d_arena_reset(&arena);
+  arena.peak = 0;
+  stub_stats.allocs = 0;
+  stub_stats.spills = 0;
+  stub_stats.peak = 0;
+}
+
+void stub_frame_end(void) {
+  stub_stats.peak = arena.peak;
+  vgr2d_arena_reset(&arena);
+  while (spills != NULL) {
+    spill_t *next = spills->next;
+    free(spills);
+    spills = next;
+  }
+}
+
+void *vgr2d_alloc(size_t size, int n) {
+  void *p;
+
+  stub_stats.allocs++;
+  p = vgr2d_arena_alloc(&arena, size * n);
+  if (p == NULL) {
+    spill_t *s = calloc(1, sizeof(spill_t) + size * n);
+    if (s == NULL) {
+      perror("vgr2d_alloc");
+      exit(1);
+    }
+    s->next = spills;
+    spills = s;
+    stub_stats.spills++;
+    p = s + 1;
+  }
+  return p;
+}
+
+void *vgr2d_shape_alloc(size_t size, int n) {
+  void *p = malloc(size * n);
+  if (p == NULL) {
+    perror("vgr2d_shape_alloc");
+    exit(1);
+  }
+  return p;
+}
+
+void cmdbuf_init(cmdbuf_t *out) {
+  out->alloc = 256;
+  out->len = 0;
+  out->saved = 0;
+  out->fixed = false;
+  out->buf = malloc(out->alloc);
+  if (out->buf == NULL) {
+    perror("cmdbuf_init");
+    exit(1);
+  }
+}
+
+void cmdbuf_free(cmdbuf_t *out) {
+  free(out->buf);
+  out->buf = NULL;
+}
+
+void vgr2d_cmd_grow(cmdbuf_t *out) {
+  if (out->fixed) {
+    fprintf(stderr, "command buffer overflow\n");
+    exit(1);
+  }
+  out->alloc = (out->alloc > 0) ? out->alloc << 1 : 32;
+  out->buf = realloc(out->buf, out->alloc);
+  if (out->buf == NULL) {
+    perror("vgr2d_cmd_grow");
+    exit(1);
+  }
+}
@@ -0,0 +1,31 @@
+#ifndef STUB_H
+#define STUB_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "vgr2dlib.h"
+#include "vgr2dcmd.h"
+
+#define STUB_ARENA_SIZE 4096 // same as the firmware default
+
+// Per-frame allocation counters, cleared by stub_frame_begin()
+typedef struct stub_stats_s {
+  unsigned allocs;  // vgr2d_alloc calls
+  unsigned spills;  // calls that did not fit in the arena
+  size_t peak;      // arena high-water mark including spills
+} stub_stats_t;
+
+extern stub_stats_t stub_stats;
+
+extern void *vgr2d_alloc(size_t size, int n);
+extern void *vgr2d_shape_alloc(size_t size, int n);
+
+extern void stub_frame_begin(void);
+extern void stub_frame_end(void);
+
+extern void cmdbuf_init(cmdbuf_t *out);
+extern void cmdbuf_free(cmdbuf_t *out);
+
+#endif
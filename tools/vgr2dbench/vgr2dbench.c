@@ -0,0 +1,982 @@
+/*
+ * Host benchmark and golden-output harness for the rvgr rasterizer.
+ *
+ * Builds a fixed corpus of scenes out of the same rectangle_t/polygon_t
+ * structures the rvgr module fills in, runs them through vgr2dlib.c and
+ * the vgr2dcmd.c encoder, and either compares the command streams with
+ * the checked-in golden files or reports throughput numbers.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+
+#include "stub.h"
+#include "font.h"
+
+#define LEN(x) (sizeof(x) / sizeof *(x))
+
+#define MAX_SHAPES 128
+#define GRAPHICS_ADDR 0x0000
+
+enum shape_kind {
+  SHAPE_RECT,
+  SHAPE_POLY,
+  SHAPE_ELLIPSE,
+  SHAPE_BITMAP,
+  SHAPE_TEXT,
+};
+
+typedef struct shape_s {
+  enum shape_kind kind;
+  union {
+    rectangle_t rect;
+    polygon_t poly;
+    ellipse_t ell;
+    bitmap_t bmp;
+    text_t text;
+  } u;
+} shape_t;
+
+typedef struct scene_s {
+  char const *name;
+  void (*build)(struct scene_s *);
+  shape_t shapes[MAX_SHAPES];
+  int n;
+} scene_t;
+
+char const *arg0;
+
+
+//////////////////////////////////////// Shapes
+
+// These mirror the constructors in modgraphics.c
+
+static shape_t *new_shape(scene_t *sc, enum shape_kind kind, int x, int y) {
+  if (sc->n == MAX_SHAPES) {
+    fprintf(stderr, "%s: too many shapes\n", sc->name);
+    exit(1);
+  }
+  shape_t *sh = &sc->shapes[sc->n++];
+  memset(sh, 0, sizeof *sh);
+  sh->kind = kind;
+  // every shape struct starts with its transform
+  init_transform(&sh->u.rect.tr);
+  sh->u.rect.tr.tx = x * XSCALE; // x may be negative
+  sh->u.rect.tr.ty = YFX(y);
+  return sh;
+}
+
+static void add_rect(scene_t *sc, int x, int y, int w, int h, uint8_t clr) {
+  rectangle_t *r = &new_shape(sc, SHAPE_RECT, x, y)->u.rect;
+  r->fill = true;
+  r->w = w;
+  r->h = h;
+  r->fclr = clr;
+}
+
+static uint16_t *copy_points(int const *xy, int n, bool close) {
+  uint16_t *pts = calloc(2 * n + 2, sizeof(uint16_t));
+  int i;
+
+  for (i = 0; i < 2 * n; i += 2) {
+    pts[i] = XFX(xy[i]);
+    pts[i+1] = YFX(xy[i+1]);
+  }
+  if (close) {
+    pts[i] = pts[0];
+    pts[i+1] = pts[1];
+  }
+  return pts;
+}
+
+static void add_polygon(scene_t *sc, int x, int y, int const *xy, int n, uint8_t clr) {
+  polygon_t *p = &new_shape(sc, SHAPE_POLY, x, y)->u.poly;
+  p->fill = true;
+  p->fclr = clr;
+  p->width = 3;
+  p->n_pts = 2 * n + 2;
+  p->pts = copy_points(xy, n, true);
+  polygon_build_edges(p);
+}
+
+static void add_polyline(scene_t *sc, int x, int y, int const *xy, int n, uint8_t clr, int width) {
+  polygon_t *p = &new_shape(sc, SHAPE_POLY, x, y)->u.poly;
+  p->stroke = true;
+  p->sclr = clr;
+  p->width = width;
+  p->n_pts = 2 * n;
+  p->pts = copy_points(xy, n, false);
+  polygon_build_edges(p);
+}
+
+// width 0 fills; sweep 360 is a whole ellipse
+static void add_arc(scene_t *sc, int x, int y, int rx, int ry, int start, int sweep, uint8_t clr, int width) {
+  ellipse_t *e = &new_shape(sc, SHAPE_ELLIPSE, x, y)->u.ell;
+  if (width == 0) {
+    e->fill = true;
+    e->fclr = clr;
+  } else {
+    e->stroke = true;
+    e->sclr = clr;
+  }
+  e->rx = rx;
+  e->ry = ry;
+  e->width = width;
+  e->start = start;
+  e->sweep = sweep;
+}
+
+static void add_ellipse(scene_t *sc, int x, int y, int rx, int ry, uint8_t clr, int width) {
+  add_arc(sc, x, y, rx, ry, 0, 360, clr, width);
+}
+
+// data is w x h pixels packed MSB first, rows padded to a byte
+static void add_bitmap(scene_t *sc, int x, int y, int w, int h, uint8_t const *data, int bpp, uint8_t const *clr) {
+  bitmap_t *b = &new_shape(sc, SHAPE_BITMAP, x, y)->u.bmp;
+  b->w = w;
+  b->h = h;
+  bitmap_encode(b, data, bpp, clr);
+}
+
+static void add_text(scene_t *sc, int x, int y, char const *s, uint8_t clr) {
+  text_t *t = &new_shape(sc, SHAPE_TEXT, x, y)->u.text;
+  t->font = font_50_spans;
+  t->index = font_50_spans_index;
+  t->clr = clr;
+  text_encode(t, s, strlen(s));
+}
+
+// pivot(px, py), rotate(deg) and scale(s) on the last shape added, scale
+// in 1/100s
+static void transform_last(scene_t *sc, int deg, int sx, int sy, int px, int py) {
+  transform_t *tr = &sc->shapes[sc->n-1].u.rect.tr;
+  transform_set_pivot(tr, XFX(px), YFX(py));
+  transform_set_linear(tr, deg, sx * XFORM_ONE / 100, sy * XFORM_ONE / 100);
+}
+
+// Stroke join of the last polyline added, the edge table is sized by it
+static void join_last(scene_t *sc, uint8_t join) {
+  polygon_t *p = &sc->shapes[sc->n-1].u.poly;
+  p->join = join;
+  free(p->edges);
+  p->edges = NULL;
+  polygon_build_edges(p);
+}
+
+static void free_scene(scene_t *sc) {
+  for (int i = 0; i < sc->n; i++) {
+    polygon_t *p = NULL;
+    if (sc->shapes[i].kind == SHAPE_POLY) {
+      p = &sc->shapes[i].u.poly;
+      free(p->pts);
+    } else if (sc->shapes[i].kind == SHAPE_RECT)
+      p = &sc->shapes[i].u.rect.outline;
+    else if (sc->shapes[i].kind == SHAPE_BITMAP || sc->shapes[i].kind == SHAPE_TEXT) {
+      free(sc->shapes[i].u.bmp.runs);
+      free(sc->shapes[i].u.bmp.rows);
+    }
+    if (p != NULL) {
+      free(p->edges);
+      free(p->xpts);
+    }
+  }
+  sc->n = 0;
+}
+
+
+//////////////////////////////////////// Corpus
+
+// sin(i*pi/16)*1024 for a quarter turn, keeps the corpus free of libm
+// rounding differences between hosts
+static int const sin_tab[] = {
+  0, 200, 392, 569, 724, 851, 946, 1004, 1024
+};
+
+static int isin(int i) { // i in 1/32 turns
+  i &= 31;
+  if (i <= 8) return sin_tab[i];
+  if (i <= 16) return sin_tab[16 - i];
+  if (i <= 24) return -sin_tab[i - 16];
+  return -sin_tab[32 - i];
+}
+
+static int icos(int i) {
+  return isin(i + 8);
+}
+
+static void circle_points(int *xy, int n, int cx, int cy, int r) {
+  for (int i = 0; i < n; i++) {
+    xy[2*i] = cx + (r * icos(i * 32 / n)) / 1024;
+    xy[2*i+1] = cy + (r * isin(i * 32 / n)) / 1024;
+  }
+}
+
+static void scene_rects(scene_t *sc) {
+  for (int j = 0; j < 6; j++)
+    for (int i = 0; i < 8; i++)
+      add_rect(sc, 10 + i * 78, 10 + j * 64, 60, 40, 1 + (i + j) % 7);
+}
+
+static void scene_polygons(scene_t *sc) {
+  int const tri[] = {0,0, 120,40, 30,110};
+  int const star[] = {50,0, 62,35, 100,38, 70,60, 80,100, 50,77, 20,100, 30,60, 0,38, 38,35};
+  int const zig[] = {0,0, 20,40, 40,0, 60,40, 80,0, 100,40, 120,0, 140,40, 160,0, 160,80, 0,80};
+  int circle[2*32];
+
+  add_polygon(sc, 20, 20, tri, LEN(tri)/2, 1);
+  add_polygon(sc, 200, 30, star, LEN(star)/2, 2);
+  add_polygon(sc, 360, 20, zig, LEN(zig)/2, 3);
+  circle_points(circle, 32, 100, 100, 90);
+  add_polygon(sc, 60, 180, circle, 32, 4);
+  add_polygon(sc, 400, 200, star, LEN(star)/2, 5);
+}
+
+static void scene_polylines(scene_t *sc) {
+  int trace[2*60];
+  int const zig[] = {0,60, 40,0, 80,60, 120,0, 160,60, 200,0, 240,60};
+  int const box[] = {0,0, 200,0, 200,100, 0,100, 0,0};
+  int const spike[] = {0,0, 30,120, 60,0, 90,120, 120,40, 150,60};
+
+  for (int i = 0; i < 60; i++) {
+    trace[2*i] = i * 10;
+    trace[2*i+1] = 60 + (50 * isin(i)) / 1024;
+  }
+  add_polyline(sc, 10, 10, trace, 60, 1, 3);
+  add_polyline(sc, 20, 150, zig, LEN(zig)/2, 2, 5);
+  add_polyline(sc, 320, 150, zig, LEN(zig)/2, 3, 2);
+  add_polyline(sc, 40, 260, box, LEN(box)/2, 4, 4);
+  add_polyline(sc, 300, 250, spike, LEN(spike)/2, 5, 9);
+  add_polyline(sc, 470, 250, spike, LEN(spike)/2, 6, 9);
+  join_last(sc, JOIN_ROUND);
+  add_polyline(sc, 300, 250, spike, LEN(spike)/2, 7, 3);
+  join_last(sc, JOIN_BEVEL);
+}
+
+static void scene_overlap(scene_t *sc) {
+  int const tri[] = {0,0, 200,60, 60,180};
+  int circle[2*24];
+
+  for (int i = 0; i < 40; i++)
+    add_rect(sc, 20 + (i * 37) % 500, 20 + (i * 53) % 300, 60 + (i % 5) * 20, 30 + (i % 3) * 20, 1 + i % 7);
+  for (int i = 0; i < 6; i++)
+    add_polygon(sc, 40 + i * 90, 60 + (i % 2) * 100, tri, LEN(tri)/2, 1 + i % 7);
+  circle_points(circle, 24, 80, 80, 70);
+  for (int i = 0; i < 4; i++)
+    add_polygon(sc, 100 + i * 120, 150, circle, 24, 2 + i);
+}
+
+static void scene_gauge(scene_t *sc) {
+  int ring[2*33];
+  int const needle[] = {0,0, 100,10};
+
+  circle_points(ring, 32, 150, 150, 140);
+  ring[64] = ring[0];
+  ring[65] = ring[1];
+  add_polyline(sc, 170, 50, ring, 33, 1, 3);
+  for (int i = 0; i < 32; i += 2) {
+    int tick[4];
+    tick[0] = 150 + (120 * icos(i)) / 1024;
+    tick[1] = 150 + (120 * isin(i)) / 1024;
+    tick[2] = 150 + (135 * icos(i)) / 1024;
+    tick[3] = 150 + (135 * isin(i)) / 1024;
+    add_polyline(sc, 170, 50, tick, 2, 2, 2);
+  }
+  add_polyline(sc, 320, 200, needle, 2, 3, 3);
+  add_rect(sc, 310, 190, 20, 20, 4);
+}
+
+// The gauge scene again with native ellipses and arcs
+static void scene_dial(scene_t *sc) {
+  int const needle[] = {0,0, 100,10};
+
+  add_ellipse(sc, 320, 200, 140, 140, 1, 3);
+  for (int i = 0; i < 32; i += 2) {
+    int tick[4];
+    tick[0] = 150 + (120 * icos(i)) / 1024;
+    tick[1] = 150 + (120 * isin(i)) / 1024;
+    tick[2] = 150 + (135 * icos(i)) / 1024;
+    tick[3] = 150 + (135 * isin(i)) / 1024;
+    add_polyline(sc, 170, 50, tick, 2, 2, 2);
+  }
+  add_arc(sc, 320, 200, 100, 100, 135, 270, 5, 8);
+  add_arc(sc, 320, 200, 60, 60, 300, 100, 6, 0);
+  add_polyline(sc, 320, 200, needle, 2, 3, 3);
+  add_ellipse(sc, 320, 200, 10, 10, 4, 0);
+  add_ellipse(sc, 560, 80, 60, 30, 7, 0);
+  add_ellipse(sc, 560, 300, 30, 60, 2, 5);
+}
+
+// A map scrolled up and left, most of it off screen: shapes cut by every
+// edge of the view and shapes wholly outside it
+static void scene_scroll(scene_t *sc) {
+  int const tri[] = {0,0, 200,60, 60,180};
+  int const road[] = {0,0, 300,120, 500,80, 900,300};
+  int circle[2*24];
+
+  for (int j = 0; j < 6; j++)
+    for (int i = 0; i < 8; i++)
+      add_rect(sc, -400 + i * 160, -300 + j * 150, 120, 100, 1 + (i + j) % 7);
+  add_polygon(sc, -120, -60, tri, LEN(tri)/2, 2);
+  add_polygon(sc, 560, 340, tri, LEN(tri)/2, 3);
+  add_polygon(sc, 700, 100, tri, LEN(tri)/2, 4);
+  circle_points(circle, 24, 80, 80, 70);
+  add_polygon(sc, 300, -100, circle, 24, 5);
+  add_polygon(sc, 300, 500, circle, 24, 6);
+  add_polyline(sc, -200, -40, road, LEN(road)/2, 7, 5);
+  add_ellipse(sc, 0, 200, 80, 60, 1, 0);
+  add_ellipse(sc, 640, 0, 100, 100, 2, 6);
+  add_arc(sc, 320, 420, 150, 80, 180, 180, 3, 0);
+  add_ellipse(sc, -300, 200, 50, 50, 4, 0);
+}
+
+// A grid of 120 small icons, each line crossing only one row of them
+static void scene_icons(scene_t *sc) {
+  int const tri[] = {0,16, 8,0, 16,16};
+
+  for (int j = 0; j < 12; j++)
+    for (int i = 0; i < 10; i++) {
+      int x = 20 + i * 62, y = 6 + j * 33;
+      switch ((i + j) % 3) {
+      case 0: add_rect(sc, x, y, 18, 18, 1 + i % 7); break;
+      case 1: add_ellipse(sc, x + 9, y + 9, 9, 9, 1 + j % 7, 0); break;
+      default: add_polygon(sc, x, y, tri, LEN(tri)/2, 1 + (i + j) % 7); break;
+      }
+    }
+}
+
+// Draw a 2 bit face into a packed 32x32 icon: ring 1, eyes 2, mouth 3
+static void face_icon(uint8_t *data) {
+  memset(data, 0, 8 * 32);
+  for (int y = 0; y < 32; y++)
+    for (int x = 0; x < 32; x++) {
+      int dx = 2*x - 31, dy = 2*y - 31, d = dx*dx + dy*dy, v = 0;
+      if (d <= 31*31 && d >= 25*25)
+	v = 1;
+      else if (((x - 10)*(x - 10) + (y - 11)*(y - 11) <= 9) || ((x - 21)*(x - 21) + (y - 11)*(y - 11) <= 9))
+	v = 2;
+      else if (y >= 19 && y <= 22 && d < 20*20)
+	v = 3;
+      data[y*8 + x/4] |= v << (6 - 2*(x%4));
+    }
+}
+
+// Icons and a 1 bit banner, some clipped by the view edges
+static void scene_bitmaps(scene_t *sc) {
+  uint8_t face[8 * 32];
+  uint8_t const face_clr[] = {5, 1, 2};
+  uint8_t stripes[6 * 24];
+  uint8_t const stripe_clr[] = {6};
+
+  face_icon(face);
+  for (int y = 0; y < 24; y++)
+    for (int i = 0; i < 6; i++)
+      stripes[y*6 + i] = (y & 4) ? 0xf0 >> (y & 3) : 0x81 << (y & 1);
+  for (int j = 0; j < 8; j++)
+    for (int i = 0; i < 12; i++)
+      add_bitmap(sc, -12 + i * 56, -10 + j * 56, 32, 32, face, 2, face_clr);
+  add_bitmap(sc, 200, 380, 48, 24, stripes, 1, stripe_clr);
+  add_bitmap(sc, 610, 200, 48, 24, stripes, 1, stripe_clr);
+}
+
+// A compass rose, rotated and scaled copies of one icon, and transformed
+// rects and ellipses, each turning about its own center
+static void scene_rotate(scene_t *sc) {
+  int const arrow[] = {64,4, 76,64, 64,124, 52,64};
+  int const icon[] = {0,0, 40,0, 40,40, 20,25, 0,40};
+  int const zig[] = {0,20, 30,0, 60,20, 90,0, 120,20};
+
+  for (int i = 0; i < 8; i++) {
+    add_polygon(sc, 76, 76, arrow, LEN(arrow)/2, 1 + i % 2);
+    transform_last(sc, i * 45, 100, 100, 64, 64);
+  }
+  for (int i = 0; i < 6; i++) {
+    add_polygon(sc, 280 + i * 60, 40, icon, LEN(icon)/2, 3 + i % 3);
+    transform_last(sc, i * 30, 50 + i * 20, 50 + i * 20, 20, 20);
+  }
+  add_polyline(sc, 260, 190, zig, LEN(zig)/2, 6, 3);
+  transform_last(sc, 20, 150, 100, 60, 10);
+  add_rect(sc, 420, 160, 80, 40, 2);
+  transform_last(sc, 30, 100, 100, 40, 20);
+  add_rect(sc, 560, 160, 40, 20, 3);
+  transform_last(sc, 0, 150, 300, 20, 10);
+  add_ellipse(sc, 140, 320, 60, 30, 4, 0);
+  transform_last(sc, 90, 100, 100, 0, 0);
+  add_arc(sc, 320, 320, 50, 50, 0, 90, 5, 0);
+  transform_last(sc, 135, 150, 150, 0, 0);
+  add_ellipse(sc, 520, 320, 40, 20, 7, 4);
+  transform_last(sc, 0, 200, 100, 0, 0);
+}
+
+// A HUD of labels over panels, with text clipped by the view edges
+static void scene_text(scene_t *sc) {
+  add_rect(sc, 10, 10, 300, 70, 1);
+  add_text(sc, 20, 20, "12:34", 7);
+  add_rect(sc, 330, 10, 300, 70, 2);
+  add_text(sc, 340, 20, "98% ok", 3);
+  add_text(sc, 20, 120, "The quick brown fox", 4);
+  add_text(sc, 20, 180, "jumps over {lazy} dogs!", 5);
+  add_ellipse(sc, 320, 310, 60, 40, 6, 0);
+  add_text(sc, 280, 285, "@#&", 1);
+  add_text(sc, -30, 250, "clipped left", 2);
+  add_text(sc, 480, 370, "and bottom", 3);
+}
+
+// Shapes reaching far past the view, with vertices beyond x = 2047 where
+// XFX no longer fits 16 bits
+static void scene_far(scene_t *sc) {
+  int const wedge[] = {1000,0, 3000,120, 1000,240};
+  int const road[] = {1000,0, 2900,100, 1000,200};
+  int const spike[] = {1000,0, 3000,60, 1000,120};
+
+  add_polygon(sc, -2500, 10, wedge, LEN(wedge)/2, 1);
+  add_polyline(sc, -2300, 150, road, LEN(road)/2, 2, 5);
+  add_polygon(sc, -700, 270, spike, LEN(spike)/2, 3);
+}
+
+static scene_t corpus[] = {
+  { "rects", scene_rects },
+  { "polygons", scene_polygons },
+  { "polylines", scene_polylines },
+  { "overlap", scene_overlap },
+  { "gauge", scene_gauge },
+  { "dial", scene_dial },
+  { "scroll", scene_scroll },
+  { "rotate", scene_rotate },
+  { "icons", scene_icons },
+  { "bitmaps", scene_bitmaps },
+  { "text", scene_text },
+  { "far", scene_far },
+};
+
+
+//////////////////////////////////////// Frames
+
+static iter_base_t *make_iter(shape_t *sh) {
+  switch (sh->kind) {
+  case SHAPE_RECT: {
+    if (!transform_identity(&sh->u.rect.tr)) {
+      poly_iter_t *iter = (poly_iter_t *)vgr2d_alloc(sizeof(poly_iter_t), 1);
+      init_polygon_iter(rectangle_outline(&sh->u.rect), iter);
+      return (iter_base_t *)iter;
+    }
+    rect_iter_t *iter = (rect_iter_t *)vgr2d_alloc(sizeof(rect_iter_t), 1);
+    init_rectangle_iter(&sh->u.rect, iter);
+    return (iter_base_t *)iter;
+  }
+  case SHAPE_POLY: {
+    poly_iter_t *iter = (poly_iter_t *)vgr2d_alloc(sizeof(poly_iter_t), 1);
+    init_polygon_iter(&sh->u.poly, iter);
+    return (iter_base_t *)iter;
+  }
+  case SHAPE_ELLIPSE: {
+    ellipse_iter_t *iter = (ellipse_iter_t *)vgr2d_alloc(sizeof(ellipse_iter_t), 1);
+    init_ellipse_iter(&sh->u.ell, iter);
+    return (iter_base_t *)iter;
+  }
+  case SHAPE_BITMAP: {
+    bitmap_iter_t *iter = (bitmap_iter_t *)vgr2d_alloc(sizeof(bitmap_iter_t), 1);
+    init_bitmap_iter(&sh->u.bmp, iter);
+    return (iter_base_t *)iter;
+  }
+  case SHAPE_TEXT: {
+    bitmap_iter_t *iter = (bitmap_iter_t *)vgr2d_alloc(sizeof(bitmap_iter_t), 1);
+    init_bitmap_iter(&sh->u.text.bmp, iter);
+    return (iter_base_t *)iter;
+  }
+  }
+  return NULL;
+}
+
+static bool on_screen(shape_t *sh) {
+  bbox_t bb;
+
+  switch (sh->kind) {
+  case SHAPE_RECT:
+    rectangle_bounds(&sh->u.rect, &bb);
+    break;
+  case SHAPE_POLY:
+    polygon_bounds(&sh->u.poly, &bb);
+    break;
+  case SHAPE_ELLIPSE:
+    ellipse_bounds(&sh->u.ell, &bb);
+    break;
+  case SHAPE_BITMAP:
+    bitmap_bounds(&sh->u.bmp, &bb);
+    break;
+  case SHAPE_TEXT:
+    bitmap_bounds(&sh->u.text.bmp, &bb);
+    break;
+  }
+  return vgr2d_visible(&bb);
+}
+
+// One rvgr.generate() call
+static void frame(scene_t *sc, cmdbuf_t *out) {
+  iter_base_t **iters;
+  int n = 0;
+
+  out->len = 0;
+  out->saved = 0;
+  stub_frame_begin();
+  iters = (iter_base_t **)vgr2d_alloc(sizeof(iter_base_t *), sc->n);
+  for (int i = 0; i < sc->n; i++)
+    if (on_screen(&sc->shapes[i]))
+      iters[n++] = make_iter(&sc->shapes[i]);
+  vgr2d_encode(GRAPHICS_ADDR, iters, n, out);
+  stub_frame_end();
+}
+
+// Count the scanlines a command stream draws on
+static int count_lines(cmdbuf_t *out) {
+  int lines = 0;
+  bool drawn = false;
+
+  // the last word is the 0xffff terminator
+  for (size_t i = 2; i + 3 < out->len; i += 2) {
+    uint16_t cmd = (out->buf[i] << 8) | out->buf[i+1];
+    if ((cmd & 0xf000) == 0xf000 || (cmd & 0xe000) == 0xa000)
+      drawn = false;
+    else if ((cmd & 0x8000) == 0 && !drawn) {
+      drawn = true;
+      lines++;
+    }
+  }
+  return lines;
+}
+
+// One rvgr.Scene regeneration with every band dirty, concatenated the
+// way Scene.generate() returns it
+static void frame_bands(scene_t *sc, cmdbuf_t *bands, cmdbuf_t *out) {
+  iter_base_t **iters;
+  int n = 0;
+
+  stub_frame_begin();
+  iters = (iter_base_t **)vgr2d_alloc(sizeof(iter_base_t *), sc->n);
+  for (int i = 0; i < sc->n; i++)
+    if (on_screen(&sc->shapes[i]))
+      iters[n++] = make_iter(&sc->shapes[i]);
+  vgr2d_encode_bands(iters, n, BAND_BIT(NUM_BANDS) - 1, bands);
+  stub_frame_end();
+
+  out->len = 0;
+  out->buf[out->len++] = GRAPHICS_ADDR >> 8;
+  out->buf[out->len++] = GRAPHICS_ADDR & 0xff;
+  for (int b = 0; b < NUM_BANDS; b++) {
+    while (out->len + bands[b].len + 2 > out->alloc)
+      vgr2d_cmd_grow(out);
+    memcpy(out->buf + out->len, bands[b].buf, bands[b].len);
+    out->len += bands[b].len;
+  }
+  out->buf[out->len++] = 0xff;
+  out->buf[out->len++] = 0xff;
+}
+
+
+// One rvgr.compile() call, replayed moved by dx pixels and dy lines
+static void frame_replay(scene_t *sc, compiled_t *c, int dx, int dy, cmdbuf_t *out) {
+  iter_base_t **iters;
+  int n = 0;
+
+  stub_frame_begin();
+  iters = (iter_base_t **)vgr2d_alloc(sizeof(iter_base_t *), sc->n);
+  for (int i = 0; i < sc->n; i++)
+    if (on_screen(&sc->shapes[i]))
+      iters[n++] = make_iter(&sc->shapes[i]);
+  vgr2d_compile(iters, n, c);
+  stub_frame_end();
+
+  out->len = 0;
+  vgr2d_replay(GRAPHICS_ADDR, c, XFX(dx), dy, out);
+}
+
+// One display2d(..., delta=True) call
+static void frame_delta(scene_t *sc, uint32_t *hashes, bool valid, cmdbuf_t *out) {
+  iter_base_t **iters;
+  int n = 0;
+
+  out->len = 0;
+  stub_frame_begin();
+  iters = (iter_base_t **)vgr2d_alloc(sizeof(iter_base_t *), sc->n);
+  for (int i = 0; i < sc->n; i++)
+    if (on_screen(&sc->shapes[i]))
+      iters[n++] = make_iter(&sc->shapes[i]);
+  vgr2d_encode_delta(GRAPHICS_ADDR, iters, n, hashes, valid, out);
+  stub_frame_end();
+}
+
+//////////////////////////////////////// Decoding
+
+#define MAX_LINE_SPANS 64
+
+typedef struct span_s {
+  uint16_t x1, x2;
+  uint8_t clr;
+} span_t;
+
+typedef struct line_s {
+  int n;
+  span_t spans[MAX_LINE_SPANS];
+} line_t;
+
+static line_t decoded[2][VIEW_HEIGHT];
+
+// Replay a command stream onto per-line spans, leaving lines it does not
+// address as they were. A line command starts the line over, as the FPGA
+// does.
+static void apply(cmdbuf_t *out, line_t *lines) {
+  uint16_t x = 0;
+  int y = 0;
+  span_t *sp = NULL;
+
+  for (size_t i = 2; i + 3 < out->len; i += 2) {
+    uint16_t cmd = (out->buf[i] << 8) | out->buf[i+1];
+    if ((cmd & 0xf000) == 0xf000 || (cmd & 0xe000) == 0xa000) {
+      if ((cmd & 0xf000) == 0xf000) {
+	y = cmd & 0x0fff;
+	x = 0;
+      } else {
+	y++;
+	x = cmd & 0x1fff;
+      }
+      if (y < VIEW_HEIGHT)
+	lines[y].n = 0;
+      sp = NULL;
+    } else if ((cmd & 0xc000) == 0xc000) {
+      if (sp != NULL) {
+	sp->x2 += cmd & 0x3fff;
+	x = sp->x2 + 1;
+      }
+    } else if (cmd & 0x8000)
+      x += cmd & 0x7fff;
+    else if (y < VIEW_HEIGHT && lines[y].n < MAX_LINE_SPANS) {
+      sp = &lines[y].spans[lines[y].n++];
+      sp->x1 = x;
+      sp->x2 = x + (cmd & 0xff);
+      sp->clr = cmd >> 8;
+      x = sp->x2 + 1;
+    }
+  }
+}
+
+static void decode(cmdbuf_t *out, line_t *lines) {
+  memset(lines, 0, VIEW_HEIGHT * sizeof *lines);
+  apply(out, lines);
+}
+
+static void print_line(char const *tag, line_t *ln) {
+  printf("     %-4s", tag);
+  for (int i = 0; i < ln->n; i++)
+    printf(" %u-%u:%u", ln->spans[i].x1, ln->spans[i].x2, ln->spans[i].clr);
+  printf("\n");
+}
+
+// The band encoding must draw exactly what the one-shot encoding draws
+static bool check_bands(scene_t *sc, cmdbuf_t *out, cmdbuf_t *bands, cmdbuf_t *tmp) {
+  // a word wrapping into the terminator would cut the stream short
+  for (size_t i = 2; i + 3 < out->len; i += 2) {
+    if (out->buf[i] == 0xff && out->buf[i+1] == 0xff) {
+      printf("FAIL %-10s bands: terminator inside stream at byte %zu\n", sc->name, i);
+      return false;
+    }
+  }
+  decode(out, decoded[0]);
+  frame_bands(sc, bands, tmp);
+  decode(tmp, decoded[1]);
+  for (int y = 0; y < VIEW_HEIGHT; y++) {
+    line_t *a = &decoded[0][y], *b = &decoded[1][y];
+    if (a->n != b->n || memcmp(a->spans, b->spans, a->n * sizeof(span_t)) != 0) {
+      printf("FAIL %-10s bands differ on line %d\n", sc->name, y);
+      print_line("want", a);
+      print_line("got", b);
+      return false;
+    }
+  }
+  printf("ok   %-10s bands %zu bytes\n", sc->name, tmp->len);
+  return true;
+}
+
+
+// A compiled stream must draw what the one-shot encoding draws, and the
+// same spans moved when replayed at another origin
+static bool check_replay(scene_t *sc, cmdbuf_t *out, compiled_t *c, cmdbuf_t *tmp) {
+  int dx, dy;
+
+  decode(out, decoded[0]);
+  for (int pass = 0; pass < 2; pass++) {
+    dx = dy = 0;
+    if (pass) {
+      // as far as the extent of the first pass lets it move
+      dx = (VIEW_XMAX - c->x2) / XSCALE;
+      dy = VIEW_HEIGHT-1 - c->y2;
+      dx = (dx > 37) ? 37 : dx;
+      dy = (dy > 11) ? 11 : dy;
+    }
+    frame_replay(sc, c, dx, dy, tmp);
+    decode(tmp, decoded[1]);
+    for (int y = 0; y < VIEW_HEIGHT; y++) {
+      line_t *a = &decoded[0][y], *b = &decoded[1][y];
+      bool same = true;
+      if (y + dy >= VIEW_HEIGHT)
+	same = a->n == 0;
+      else {
+	b = &decoded[1][y + dy];
+	same = a->n == b->n;
+	for (int i = 0; same && i < a->n; i++)
+	  same = b->spans[i].x1 == a->spans[i].x1 + XFX(dx) &&
+	    b->spans[i].x2 == a->spans[i].x2 + XFX(dx) && b->spans[i].clr == a->spans[i].clr;
+      }
+      if (!same) {
+	printf("FAIL %-10s replay at %d,%d differs on line %d\n", sc->name, dx, dy, y);
+	print_line("want", a);
+	print_line("got", b);
+	return false;
+      }
+    }
+  }
+  printf("ok   %-10s replay at %d,%d %zu bytes\n", sc->name, dx, dy, tmp->len);
+  return true;
+}
+
+static bool same_lines(scene_t *sc, char const *what) {
+  for (int y = 0; y < VIEW_HEIGHT; y++) {
+    line_t *a = &decoded[0][y], *b = &decoded[1][y];
+    if (a->n != b->n || memcmp(a->spans, b->spans, a->n * sizeof(span_t)) != 0) {
+      printf("FAIL %-10s %s differs on line %d\n", sc->name, what, y);
+      print_line("want", a);
+      print_line("got", b);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Delta frames applied over what the FPGA holds must leave the full frame:
+// from scratch, again unchanged, and after the top shape moved
+static bool check_delta(scene_t *sc, cmdbuf_t *out, cmdbuf_t *tmp) {
+  static uint32_t hashes[VIEW_HEIGHT];
+  transform_t *tr = &sc->shapes[sc->n-1].u.rect.tr;
+  size_t first;
+
+  decode(out, decoded[0]);
+  memset(decoded[1], 0, sizeof decoded[1]);
+  frame_delta(sc, hashes, false, tmp);
+  apply(tmp, decoded[1]);
+  if (!same_lines(sc, "delta"))
+    return false;
+  first = tmp->len;
+
+  frame_delta(sc, hashes, true, tmp);
+  if (tmp->len != 4) {
+    printf("FAIL %-10s unchanged delta sent %zu bytes\n", sc->name, tmp->len);
+    return false;
+  }
+
+  tr->tx += XFX(5);
+  tr->ty += YFX(3);
+  frame(sc, out);
+  decode(out, decoded[0]);
+  frame_delta(sc, hashes, true, tmp);
+  apply(tmp, decoded[1]);
+  tr->tx -= XFX(5);
+  tr->ty -= YFX(3);
+  if (!same_lines(sc, "moved delta"))
+    return false;
+  printf("ok   %-10s delta %zu bytes, moved %zu of %zu\n", sc->name, first, tmp->len, out->len);
+  return true;
+}
+
+//////////////////////////////////////// Golden files
+
+static char *format_stream(cmdbuf_t *out, size_t *len) {
+  size_t n = out->len / 2;
+  char *s = malloc(n * 5 + n / 8 + 2);
+  char *p = s;
+
+  for (size_t i = 0; i < n; i++) {
+    p += sprintf(p, "%02x%02x", out->buf[2*i], out->buf[2*i+1]);
+    *p++ = (i % 8 == 7 || i == n - 1) ? '\n' : ' ';
+  }
+  *p = '\0';
+  *len = p - s;
+  return s;
+}
+
+static char *read_file(char const *path, size_t *len) {
+  FILE *fp = fopen(path, "r");
+  char *s;
+  long n;
+
+  if (fp == NULL)
+    return NULL;
+  fseek(fp, 0, SEEK_END);
+  n = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  s = malloc(n + 1);
+  *len = fread(s, 1, n, fp);
+  s[*len] = '\0';
+  fclose(fp);
+  return s;
+}
+
+static bool check_golden(char const *dir, scene_t *sc, cmdbuf_t *out) {
+  char path[256];
+  size_t got_len, want_len;
+  char *got, *want;
+  bool ok;
+
+  snprintf(path, sizeof path, "%s/%s.hex", dir, sc->name);
+  got = format_stream(out, &got_len);
+  want = read_file(path, &want_len);
+  if (want == NULL) {
+    printf("FAIL %-10s %s: %s\n", sc->name, path, strerror(errno));
+    free(got);
+    return false;
+  }
+  ok = got_len == want_len && memcmp(got, want, got_len) == 0;
+  if (ok)
+    printf("ok   %-10s %zu bytes\n", sc->name, out->len);
+  else {
+    size_t i;
+    for (i = 0; i < got_len && i < want_len && got[i] == want[i]; i++)
+      ;
+    printf("FAIL %-10s differs from %s at word %zu\n", sc->name, path, i / 5);
+  }
+  free(got);
+  free(want);
+  return ok;
+}
+
+static void write_golden(char const *dir, scene_t *sc, cmdbuf_t *out) {
+  char path[256];
+  size_t len;
+  char *s = format_stream(out, &len);
+  FILE *fp;
+
+  snprintf(path, sizeof path, "%s/%s.hex", dir, sc->name);
+  if ((fp = fopen(path, "w")) == NULL) {
+    fprintf(stderr, "%s: %s\n", path, strerror(errno));
+    exit(1);
+  }
+  fwrite(s, 1, len, fp);
+  fclose(fp);
+  free(s);
+  printf("wrote %s\n", path);
+}
+
+
+//////////////////////////////////////// Benchmark
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void bench(scene_t *sc, cmdbuf_t *out, double min_time) {
+  double t0, t;
+  long frames = 0;
+  int lines;
+
+  frame(sc, out);
+  lines = count_lines(out);
+  t0 = now();
+  do {
+    for (int i = 0; i < 16; i++)
+      frame(sc, out);
+    frames += 16;
+    t = now() - t0;
+  } while (t < min_time);
+
+  printf("%-10s %6d %8.0f %9.1f %7zu %6zu %7u %6u %7zu\n",
+	 sc->name, sc->n, lines * frames / t, 1e6 * t / frames,
+	 out->len, out->saved, stub_stats.allocs, stub_stats.spills, stub_stats.peak);
+}
+
+
+//////////////////////////////////////// Main
+
+static void usage(void) {
+  fprintf(stderr, "usage: %s [-b] [-c dir] [-g dir] [-t seconds] [scene...]\n", arg0);
+  exit(1);
+}
+
+int main(int argc, char *argv[]) {
+  char const *check_dir = NULL, *golden_dir = NULL;
+  bool do_bench = false;
+  double min_time = 0.25;
+  int failed = 0;
+  cmdbuf_t out, tmp, bands[NUM_BANDS];
+  compiled_t comp;
+
+  arg0 = *argv;
+  for (int o; (o = getopt(argc, argv, "bc:g:t:")) != -1;) {
+    switch (o) {
+    case 'b':
+      do_bench = true;
+      break;
+    case 'c':
+      check_dir = optarg;
+      break;
+    case 'g':
+      golden_dir = optarg;
+      break;
+    case 't':
+      min_time = atof(optarg);
+      break;
+    default:
+      usage();
+    }
+  }
+  argc -= optind;
+  argv += optind;
+  if (!do_bench && check_dir == NULL && golden_dir == NULL)
+    usage();
+
+  cmdbuf_init(&out);
+  cmdbuf_init(&tmp);
+  cmdbuf_init(&comp.body);
+  cmdbuf_init(&comp.lines);
+  for (int b = 0; b < NUM_BANDS; b++)
+    cmdbuf_init(&bands[b]);
+  if (do_bench)
+    printf("%-10s %6s %8s %9s %7s %6s %7s %6s %7s\n", "scene", "shapes",
+	   "lines/s", "us/frame", "bytes", "saved", "allocs", "spills", "peak");
+
+  for (size_t i = 0; i < LEN(corpus); i++) {
+    scene_t *sc = &corpus[i];
+    bool selected = argc == 0;
+
+    for (int j = 0; j < argc; j++)
+      selected |= strcmp(argv[j], sc->name) == 0;
+    if (!selected)
+      continue;
+
+    sc->build(sc);
+    frame(sc, &out);
+    if (golden_dir != NULL)
+      write_golden(golden_dir, sc, &out);
+    if (check_dir != NULL && !check_golden(check_dir, sc, &out))
+      failed++;
+    if (check_dir != NULL && !check_bands(sc, &out, bands, &tmp))
+      failed++;
+    if (check_dir != NULL && !check_replay(sc, &out, &comp, &tmp))
+      failed++;
+    if (check_dir != NULL && !check_delta(sc, &out, &tmp))
+      failed++;
+    if (do_bench)
+      bench(sc, &out, min_time);
+    free_scene(sc);
+  }
+
+  cmdbuf_free(&out);
+  cmdbuf_free(&tmp);
+  cmdbuf_free(&comp.body);
+  cmdbuf_free(&comp.lines);
+  for (int b = 0; b < NUM_BANDS; b++)
+    cmdbuf_free(&bands[b]);
+  return failed ? 1 : 0;
+}